@@ -0,0 +1,814 @@
+/// @file chartreusemodule.cc
+/// @brief Python extension module: NumPy friendly Manager and Analyzer bindings
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+// Python.h has to be included before any standard header
+#include "Python.h"
+
+// std::copy
+#include <algorithm>
+// std::strcmp
+#include <cstring>
+// std::bad_alloc
+#include <new>
+// std::unique_ptr
+#include <memory>
+// std::vector
+#include <vector>
+
+#include "chartreuse/src/algorithms/algorithms_common.h"
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/descriptors/audiopower.h"
+#include "chartreuse/src/descriptors/audiowaveform.h"
+#include "chartreuse/src/interface/analyzer.h"
+#include "chartreuse/src/interface/interface_common.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace {
+
+using chartreuse::interface::Analyzer;
+using chartreuse::interface::kAvailableDescriptorsCount;
+using chartreuse::interface::Manager;
+namespace DescriptorId = chartreuse::interface::DescriptorId;
+namespace PitchEstimator = chartreuse::interface::PitchEstimator;
+
+/// @brief Python names of all descriptors, in DescriptorId order
+static const char* const kDescriptorNames[] = {
+  "AudioPower",
+  "AudioSpectrumCentroid",
+  "AudioSpectrumSpread",
+  "AudioWaveform",
+  "AudioFundamentalFrequency",
+  "AudioHarmonicity",
+  "AudioSpectrumSkewness",
+  "AudioSpectrumKurtosis",
+  "MelBands",
+  "BarkBands",
+  "MFCC",
+  "AudioSpectrumEnvelope",
+  "AudioSpectrumFlatness",
+  "AudioUpperLimitOfHarmonicity",
+  "HarmonicSpectralCentroid",
+  "HarmonicSpectralDeviation",
+  "HarmonicSpectralSpread",
+  "HarmonicSpectralVariation",
+  "ConstantQ",
+  "OnsetStrength",
+  "SignalEnvelope",
+  "LogAttackTime",
+  "TemporalCentroid",
+  "PitchTrack",
+  "Dft",
+  "Spectrogram",
+  "DftPower",
+  "SpectrogramPower",
+  "AutoCorrelation",
+  "SpectralMoments",
+  "HarmonicPeaks",
+  "NormalizedDifference"
+};
+static_assert(sizeof(kDescriptorNames) / sizeof(kDescriptorNames[0])
+                == DescriptorId::kCount,
+              "All descriptors have to be named");
+
+/// @brief Exported buffer view, released on destruction
+///
+/// Only C-contiguous native float32 buffers are accepted: data is never
+/// copied nor converted, the library working directly on the exporter
+/// memory (e.g. a NumPy array).
+class FloatBuffer {
+ public:
+  FloatBuffer()
+      : view_(),
+        acquired_(false) {
+    // Nothing to do here for now
+  }
+
+  ~FloatBuffer() {
+    if (acquired_) {
+      PyBuffer_Release(&view_);
+    }
+  }
+
+  /// @brief Retrieve the given object buffer, set a Python error on failure
+  bool Acquire(PyObject* const object, const bool writable) {
+    const int kFlags(PyBUF_C_CONTIGUOUS
+                     | PyBUF_FORMAT
+                     | (writable ? PyBUF_WRITABLE : 0));
+    if (PyObject_GetBuffer(object, &view_, kFlags) != 0) {
+      return false;
+    }
+    acquired_ = true;
+    if ((view_.itemsize != sizeof(float))
+        || (view_.format == nullptr)
+        || ((std::strcmp(view_.format, "f") != 0)
+            && (std::strcmp(view_.format, "@f") != 0)
+            && (std::strcmp(view_.format, "=f") != 0))) {
+      PyErr_SetString(PyExc_TypeError, "buffer has to be of float32 type");
+      return false;
+    }
+    return true;
+  }
+
+  float* Data(void) const {
+    return static_cast<float*>(view_.buf);
+  }
+
+  std::size_t Length(void) const {
+    return static_cast<std::size_t>(view_.len) / sizeof(float);
+  }
+
+ private:
+  // No assignment operator for this class
+  FloatBuffer& operator=(const FloatBuffer& right);
+  // No copy constructor for this class
+  FloatBuffer(const FloatBuffer& right);
+
+  Py_buffer view_;
+  bool acquired_;
+};
+
+/// @brief Allocate a new NumPy float32 array of the given shape
+static PyObject* NewArray(const std::size_t rows, const std::size_t columns) {
+  PyObject* const numpy(PyImport_ImportModule("numpy"));
+  if (numpy == nullptr) {
+    return nullptr;
+  }
+  PyObject* const array(PyObject_CallMethod(numpy,
+                                            "empty",
+                                            "((nn)s)",
+                                            static_cast<Py_ssize_t>(rows),
+                                            static_cast<Py_ssize_t>(columns),
+                                            "float32"));
+  Py_DECREF(numpy);
+  return array;
+}
+
+/// @brief Retrieve the output object: the given one if any,
+/// a newly allocated array otherwise - in both cases a new reference
+static PyObject* OutputObject(PyObject* const out,
+                              const std::size_t rows,
+                              const std::size_t columns) {
+  if ((out == nullptr) || (out == Py_None)) {
+    return NewArray(rows, columns);
+  }
+  Py_INCREF(out);
+  return out;
+}
+
+/// @brief Check the given parameters the same way Manager::Parameters does,
+/// since assertions are not to be relied upon from Python
+static bool CheckParameters(const float sampling_freq,
+                            const unsigned int dft_length,
+                            const float low_freq,
+                            const float high_freq,
+                            const unsigned int hop_size_sample,
+                            const unsigned int overlap,
+                            const float octave_resolution,
+                            const unsigned int pitch_estimator,
+                            const float silence_threshold) {
+  const char* error(nullptr);
+  if (sampling_freq <= 0.0f) {
+    error = "sampling_freq has to be positive";
+  } else if ((dft_length < 2)
+             || !chartreuse::algorithms::IsPowerOfTwo(dft_length)) {
+    error = "dft_length has to be a power of 2";
+  } else if ((low_freq <= 0.0f)
+             || (high_freq <= low_freq)
+             || (high_freq >= sampling_freq / 2.0f)) {
+    error = "invalid low_freq / high_freq";
+  } else if ((hop_size_sample == 0) || (overlap == 0)) {
+    error = "hop_size and overlap have to be positive";
+  } else if (hop_size_sample * overlap > dft_length) {
+    error = "hop_size * overlap cannot exceed dft_length";
+  } else if ((static_cast<unsigned int>(sampling_freq / low_freq)
+              >= hop_size_sample * overlap)
+             || (static_cast<unsigned int>(sampling_freq / low_freq)
+                 <= static_cast<unsigned int>(sampling_freq / high_freq))) {
+    error = "lags range does not fit within the analysis window";
+  } else if ((octave_resolution < 1.0f / 16.0f)
+             || (octave_resolution > 8.0f)) {
+    error = "octave_resolution has to be within [1/16 ; 8]";
+  } else if (pitch_estimator >= PitchEstimator::kCount) {
+    error = "unknown pitch_estimator";
+  } else if (!(silence_threshold >= 0.0f)) {
+    error = "silence_threshold cannot be negative";
+  }
+  if (error != nullptr) {
+    PyErr_SetString(PyExc_ValueError, error);
+    return false;
+  }
+  return true;
+}
+
+/// @brief Convert the given Python sequence into descriptors identifiers
+static bool ParseDescriptors(PyObject* const sequence,
+                             std::vector<DescriptorId::Type>* const ids) {
+  PyObject* const fast(PySequence_Fast(sequence,
+                                       "descriptors has to be a sequence"));
+  if (fast == nullptr) {
+    return false;
+  }
+  const Py_ssize_t kCount(PySequence_Fast_GET_SIZE(fast));
+  bool success(kCount > 0);
+  if (!success) {
+    PyErr_SetString(PyExc_ValueError, "no descriptor given");
+  }
+  for (Py_ssize_t i(0); success && (i < kCount); ++i) {
+    const long kId(PyLong_AsLong(PySequence_Fast_GET_ITEM(fast, i)));
+    if ((kId < 0) || (kId >= DescriptorId::kCount)) {
+      if (!PyErr_Occurred()) {
+        PyErr_SetString(PyExc_ValueError, "unknown descriptor");
+      }
+      success = false;
+    } else {
+      ids->push_back(static_cast<DescriptorId::Type>(kId));
+    }
+  }
+  Py_DECREF(fast);
+  return success;
+}
+
+/// @brief Cast any method to the generic Python method type
+/// (an intermediate cast prevents function type cast warnings)
+template <typename FunctionType>
+static PyCFunction MethodCast(FunctionType function) {
+  return reinterpret_cast<PyCFunction>(
+    reinterpret_cast<void (*)(void)>(function));
+}
+
+/// @brief Same as above, for type slots
+template <typename FunctionType>
+static void* SlotCast(FunctionType function) {
+  return reinterpret_cast<void*>(function);
+}
+
+/// @brief Check if the given descriptor is only computed from each hop
+///
+/// Such descriptors do not depend on the manager framing state: their
+/// batched process method may be run over the whole signal at once.
+static bool IsHopDescriptor(const DescriptorId::Type descriptor) {
+  return (descriptor == DescriptorId::kAudioPower)
+         || (descriptor == DescriptorId::kAudioWaveform);
+}
+
+/// @brief Batched processing of the above over frames_count whole hops,
+/// the output of the i-th one being written at output[i * row_length]
+static void ProcessHops(Manager* const manager,
+                        const DescriptorId::Type descriptor,
+                        const float* const input,
+                        const std::size_t frames_count,
+                        const std::size_t row_length,
+                        float* const output) {
+  const std::size_t kHopSize(manager->AnalysisParameters().hop_size_sample);
+  if (descriptor == DescriptorId::kAudioPower) {
+    chartreuse::descriptors::AudioPower power(manager);
+    power.Process(input, kHopSize, frames_count, kHopSize, row_length, output);
+  } else {
+    CHARTREUSE_ASSERT(descriptor == DescriptorId::kAudioWaveform);
+    chartreuse::descriptors::AudioWaveform waveform(manager);
+    waveform.Process(input,
+                     kHopSize,
+                     frames_count,
+                     kHopSize,
+                     row_length,
+                     output);
+  }
+}
+
+// Manager type
+
+struct ManagerObject {
+  PyObject_HEAD
+  Manager* manager;
+  bool busy;  ///< Processing is being done without the GIL
+};
+
+/// @brief Set a Python error if the object is being processed
+/// by another thread
+static bool CheckNotBusy(const bool busy) {
+  if (busy) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "object is already processing in another thread");
+    return false;
+  }
+  return true;
+}
+
+static PyObject* Manager_new(PyTypeObject* type,
+                             PyObject* /*args*/,
+                             PyObject* /*kwargs*/) {
+  ManagerObject* const self(
+    reinterpret_cast<ManagerObject*>(type->tp_alloc(type, 0)));
+  if (self != nullptr) {
+    self->manager = nullptr;
+    self->busy = false;
+  }
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static int Manager_init(ManagerObject* self, PyObject* args, PyObject* kwargs) {
+  static const char* kKeywords[] = {"sampling_freq",
+                                    "dft_length",
+                                    "low_freq",
+                                    "high_freq",
+                                    "hop_size",
+                                    "overlap",
+                                    "octave_resolution",
+                                    "pitch_estimator",
+                                    "silence_threshold",
+                                    "zero_init",
+                                    nullptr};
+  const Manager::Parameters kDefault;
+  float sampling_freq(kDefault.sampling_freq);
+  unsigned int dft_length(kDefault.dft_length);
+  float low_freq(kDefault.low_freq);
+  float high_freq(kDefault.high_freq);
+  unsigned int hop_size_sample(kDefault.hop_size_sample);
+  unsigned int overlap(kDefault.overlap);
+  float octave_resolution(kDefault.octave_resolution);
+  unsigned int pitch_estimator(kDefault.pitch_estimator);
+  float silence_threshold(kDefault.silence_threshold);
+  int zero_init(1);
+  if (!PyArg_ParseTupleAndKeywords(args,
+                                   kwargs,
+                                   "|fIffIIfIfp",
+                                   const_cast<char**>(kKeywords),
+                                   &sampling_freq,
+                                   &dft_length,
+                                   &low_freq,
+                                   &high_freq,
+                                   &hop_size_sample,
+                                   &overlap,
+                                   &octave_resolution,
+                                   &pitch_estimator,
+                                   &silence_threshold,
+                                   &zero_init)) {
+    return -1;
+  }
+  if (!CheckNotBusy(self->busy)
+      || !CheckParameters(sampling_freq,
+                          dft_length,
+                          low_freq,
+                          high_freq,
+                          hop_size_sample,
+                          overlap,
+                          octave_resolution,
+                          pitch_estimator,
+                          silence_threshold)) {
+    return -1;
+  }
+  Manager* manager(nullptr);
+  try {
+    manager = new Manager(
+      Manager::Parameters(sampling_freq,
+                          dft_length,
+                          low_freq,
+                          high_freq,
+                          hop_size_sample,
+                          overlap,
+                          octave_resolution,
+                          static_cast<PitchEstimator::Type>(pitch_estimator),
+                          silence_threshold),
+      zero_init != 0);
+  } catch (const std::bad_alloc&) {
+    PyErr_NoMemory();
+    return -1;
+  }
+  delete self->manager;
+  self->manager = manager;
+  return 0;
+}
+
+static void Manager_dealloc(ManagerObject* self) {
+  PyTypeObject* const type(Py_TYPE(self));
+  delete self->manager;
+  type->tp_free(reinterpret_cast<PyObject*>(self));
+  // Instances of heap types hold a reference to their type
+  Py_DECREF(type);
+}
+
+/// @brief Set a Python error if the object was not initialized
+static bool CheckInitialized(const void* const instance) {
+  if (instance == nullptr) {
+    PyErr_SetString(PyExc_RuntimeError, "object is not initialized");
+    return false;
+  }
+  return true;
+}
+
+static PyObject* Manager_meta(ManagerObject* self, PyObject* args) {
+  int descriptor(0);
+  if (!PyArg_ParseTuple(args, "i", &descriptor)
+      || !CheckInitialized(self->manager)) {
+    return nullptr;
+  }
+  if ((descriptor < 0) || (descriptor >= DescriptorId::kCount)) {
+    PyErr_SetString(PyExc_ValueError, "unknown descriptor");
+    return nullptr;
+  }
+  const chartreuse::descriptors::Descriptor_Meta kMeta(
+    self->manager->GetDescriptorMeta(
+      static_cast<DescriptorId::Type>(descriptor)));
+  return Py_BuildValue("(Iff)", kMeta.out_dim, kMeta.out_min, kMeta.out_max);
+}
+
+static PyObject* Manager_gate_hit_count(ManagerObject* self, PyObject* args) {
+  int descriptor(0);
+  if (!PyArg_ParseTuple(args, "i", &descriptor)
+      || !CheckInitialized(self->manager)
+      || !CheckNotBusy(self->busy)) {
+    return nullptr;
+  }
+  if ((descriptor < 0) || (descriptor >= DescriptorId::kCount)) {
+    PyErr_SetString(PyExc_ValueError, "unknown descriptor");
+    return nullptr;
+  }
+  return PyLong_FromUnsignedLong(self->manager->GateHitCount(
+    static_cast<DescriptorId::Type>(descriptor)));
+}
+
+static PyObject* Manager_process(ManagerObject* self,
+                                 PyObject* args,
+                                 PyObject* kwargs) {
+  static const char* kKeywords[] = {"signal", "descriptors", "out", nullptr};
+  PyObject* signal(nullptr);
+  PyObject* descriptors(nullptr);
+  PyObject* out(nullptr);
+  if (!PyArg_ParseTupleAndKeywords(args,
+                                   kwargs,
+                                   "OO|O",
+                                   const_cast<char**>(kKeywords),
+                                   &signal,
+                                   &descriptors,
+                                   &out)
+      || !CheckInitialized(self->manager)
+      || !CheckNotBusy(self->busy)) {
+    return nullptr;
+  }
+  std::vector<DescriptorId::Type> ids;
+  FloatBuffer input;
+  if (!ParseDescriptors(descriptors, &ids) || !input.Acquire(signal, false)) {
+    return nullptr;
+  }
+  Manager& manager(*self->manager);
+  const std::size_t kHopSize(manager.AnalysisParameters().hop_size_sample);
+  // Nothing is held between calls: a partial hop would be lost
+  if (input.Length() % kHopSize != 0) {
+    PyErr_SetString(PyExc_ValueError,
+                    "signal length is not a multiple of hop_size");
+    return nullptr;
+  }
+  std::vector<unsigned int> dims(ids.size());
+  std::size_t row_length(0);
+  for (std::size_t i(0); i < ids.size(); ++i) {
+    manager.EnableDescriptor(ids[i], true);
+    dims[i] = manager.GetDescriptorMeta(ids[i]).out_dim;
+    row_length += dims[i];
+  }
+  const std::size_t kFramesCount(input.Length() / kHopSize);
+
+  PyObject* const result(OutputObject(out, kFramesCount, row_length));
+  if (result == nullptr) {
+    return nullptr;
+  }
+  FloatBuffer output;
+  if (!output.Acquire(result, true)) {
+    Py_DECREF(result);
+    return nullptr;
+  }
+  if (output.Length() < kFramesCount * row_length) {
+    PyErr_SetString(PyExc_ValueError, "out is too small");
+    Py_DECREF(result);
+    return nullptr;
+  }
+  if (kFramesCount == 0) {
+    return result;
+  }
+
+  const float* const kInput(input.Data());
+  float* const kOutput(output.Data());
+  self->busy = true;
+  Py_BEGIN_ALLOW_THREADS
+  // Hop descriptors are computed at once over the whole signal,
+  // directly into their column of out
+  std::size_t column(0);
+  for (std::size_t i(0); i < ids.size(); ++i) {
+    if (IsHopDescriptor(ids[i])) {
+      ProcessHops(&manager,
+                  ids[i],
+                  kInput,
+                  kFramesCount,
+                  row_length,
+                  &kOutput[column]);
+    }
+    column += dims[i];
+  }
+  // All other ones rely on the manager framing: one hop at a time,
+  // the manager being fed anyway so that its state keeps up with the signal
+  for (std::size_t frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+    manager.ProcessFrame(&kInput[frame_idx * kHopSize], kHopSize);
+    float* current_out(&kOutput[frame_idx * row_length]);
+    for (std::size_t i(0); i < ids.size(); ++i) {
+      if (!IsHopDescriptor(ids[i])) {
+        const float* const kData(manager.GetDescriptor(ids[i]));
+        std::copy(&kData[0], &kData[dims[i]], current_out);
+      }
+      current_out += dims[i];
+    }
+  }
+  Py_END_ALLOW_THREADS
+  self->busy = false;
+  return result;
+}
+
+static PyObject* Manager_reset(ManagerObject* self, PyObject* /*args*/) {
+  if (!CheckInitialized(self->manager) || !CheckNotBusy(self->busy)) {
+    return nullptr;
+  }
+  self->manager->Reset();
+  Py_RETURN_NONE;
+}
+
+static PyObject* Manager_start_segment(ManagerObject* self,
+                                       PyObject* /*args*/) {
+  if (!CheckInitialized(self->manager) || !CheckNotBusy(self->busy)) {
+    return nullptr;
+  }
+  self->manager->StartSegment();
+  Py_RETURN_NONE;
+}
+
+static PyMethodDef kManagerMethods[] = {
+  {"meta",
+   MethodCast(Manager_meta),
+   METH_VARARGS,
+   "meta(descriptor) -> (out_dim, out_min, out_max)"},
+  {"gate_hit_count",
+   MethodCast(Manager_gate_hit_count),
+   METH_VARARGS,
+   "gate_hit_count(descriptor) -> frames skipped as silent"},
+  {"process",
+   MethodCast(Manager_process),
+   METH_VARARGS | METH_KEYWORDS,
+   "process(signal, descriptors, out=None) -> out\n\n"
+   "Analyse all hops of the float32 signal, whose length has to be\n"
+   "a multiple of hop_size, retrieving the given descriptors\n"
+   "for each of them: output is a (hops, sum of out_dim)\n"
+   "float32 array, newly allocated if out is not given.\n"
+   "AudioPower and AudioWaveform are computed at once over all hops.\n"
+   "No copy is made and the GIL is released while processing."},
+  {"reset",
+   MethodCast(Manager_reset),
+   METH_NOARGS,
+   "Set the manager back to its just-constructed state"},
+  {"start_segment",
+   MethodCast(Manager_start_segment),
+   METH_NOARGS,
+   "Start a new segment for segment-based descriptors"},
+  {nullptr, nullptr, 0, nullptr}
+};
+
+static PyType_Slot kManagerSlots[] = {
+  {Py_tp_doc, const_cast<char*>(
+    "Manager(sampling_freq=48000, dft_length=2048, low_freq=62.5, "
+    "high_freq=1500, hop_size=480, overlap=3, octave_resolution=0.25, "
+    "pitch_estimator=PITCH_AUTOCORRELATION, silence_threshold=0, "
+    "zero_init=True)")},
+  {Py_tp_new, SlotCast(Manager_new)},
+  {Py_tp_init, SlotCast(Manager_init)},
+  {Py_tp_dealloc, SlotCast(Manager_dealloc)},
+  {Py_tp_methods, kManagerMethods},
+  {0, nullptr}
+};
+
+static PyType_Spec kManagerSpec = {
+  "chartreuse.Manager",
+  sizeof(ManagerObject),
+  0,
+  Py_TPFLAGS_DEFAULT,
+  kManagerSlots
+};
+
+// Analyzer type
+
+struct AnalyzerObject {
+  PyObject_HEAD
+  Analyzer* analyzer;
+  bool busy;  ///< Processing is being done without the GIL
+};
+
+static PyObject* Analyzer_new(PyTypeObject* type,
+                              PyObject* /*args*/,
+                              PyObject* /*kwargs*/) {
+  AnalyzerObject* const self(
+    reinterpret_cast<AnalyzerObject*>(type->tp_alloc(type, 0)));
+  if (self != nullptr) {
+    self->analyzer = nullptr;
+    self->busy = false;
+  }
+  return reinterpret_cast<PyObject*>(self);
+}
+
+static int Analyzer_init(AnalyzerObject* self,
+                         PyObject* args,
+                         PyObject* kwargs) {
+  static const char* kKeywords[] = {"sampling_freq", nullptr};
+  float sampling_freq(0.0f);
+  if (!PyArg_ParseTupleAndKeywords(args,
+                                   kwargs,
+                                   "f",
+                                   const_cast<char**>(kKeywords),
+                                   &sampling_freq)) {
+    return -1;
+  }
+  const Manager::Parameters kDefault;
+  if (!CheckNotBusy(self->busy)
+      || !CheckParameters(sampling_freq,
+                          kDefault.dft_length,
+                          kDefault.low_freq,
+                          kDefault.high_freq,
+                          kDefault.hop_size_sample,
+                          kDefault.overlap,
+                          kDefault.octave_resolution,
+                          kDefault.pitch_estimator,
+                          kDefault.silence_threshold)) {
+    return -1;
+  }
+  Analyzer* analyzer(nullptr);
+  try {
+    analyzer = new Analyzer(sampling_freq);
+  } catch (const std::bad_alloc&) {
+    PyErr_NoMemory();
+    return -1;
+  }
+  delete self->analyzer;
+  self->analyzer = analyzer;
+  return 0;
+}
+
+static void Analyzer_dealloc(AnalyzerObject* self) {
+  PyTypeObject* const type(Py_TYPE(self));
+  delete self->analyzer;
+  type->tp_free(reinterpret_cast<PyObject*>(self));
+  Py_DECREF(type);
+}
+
+static PyObject* Analyzer_process(AnalyzerObject* self,
+                                  PyObject* args,
+                                  PyObject* kwargs) {
+  static const char* kKeywords[] = {"signal", "out", nullptr};
+  PyObject* signal(nullptr);
+  PyObject* out(nullptr);
+  if (!PyArg_ParseTupleAndKeywords(args,
+                                   kwargs,
+                                   "O|O",
+                                   const_cast<char**>(kKeywords),
+                                   &signal,
+                                   &out)
+      || !CheckInitialized(self->analyzer)
+      || !CheckNotBusy(self->busy)) {
+    return nullptr;
+  }
+  FloatBuffer input;
+  if (!input.Acquire(signal, false)) {
+    return nullptr;
+  }
+  if (input.Length() == 0) {
+    PyObject* const empty(OutputObject(out, 0, kAvailableDescriptorsCount));
+    return (empty != nullptr) ? Py_BuildValue("(NI)", empty, 0U) : nullptr;
+  }
+  // Samples remaining from the previous call may complete one more subframe
+  const std::size_t kMaxSubframesCount(
+    input.Length() / chartreuse::kHopSizeSamples + 1);
+  PyObject* const result(
+    OutputObject(out,
+                 kMaxSubframesCount,
+                 kAvailableDescriptorsCount));
+  if (result == nullptr) {
+    return nullptr;
+  }
+  FloatBuffer output;
+  if (!output.Acquire(result, true)) {
+    Py_DECREF(result);
+    return nullptr;
+  }
+  if (output.Length()
+      < kMaxSubframesCount * kAvailableDescriptorsCount) {
+    PyErr_SetString(PyExc_ValueError, "out is too small");
+    Py_DECREF(result);
+    return nullptr;
+  }
+
+  unsigned int subframes_count(0);
+  self->busy = true;
+  Py_BEGIN_ALLOW_THREADS
+  subframes_count = self->analyzer->Process(
+    input.Data(),
+    static_cast<unsigned int>(input.Length()),
+    output.Data());
+  Py_END_ALLOW_THREADS
+  self->busy = false;
+  // The output object itself is given back (slicing may copy, e.g. for
+  // array.array), along with the actually computed subframes count
+  return Py_BuildValue("(NI)", result, subframes_count);
+}
+
+static PyMethodDef kAnalyzerMethods[] = {
+  {"process",
+   MethodCast(Analyzer_process),
+   METH_VARARGS | METH_KEYWORDS,
+   "process(signal, out=None) -> (out, subframes)\n\n"
+   "Feed the float32 signal whatever its length is, retrieving the\n"
+   "normalized available descriptors of all completed subframes:\n"
+   "only the first subframes rows of out are filled.\n"
+   "No copy is made and the GIL is released while processing."},
+  {nullptr, nullptr, 0, nullptr}
+};
+
+static PyType_Slot kAnalyzerSlots[] = {
+  {Py_tp_doc, const_cast<char*>("Analyzer(sampling_freq)")},
+  {Py_tp_new, SlotCast(Analyzer_new)},
+  {Py_tp_init, SlotCast(Analyzer_init)},
+  {Py_tp_dealloc, SlotCast(Analyzer_dealloc)},
+  {Py_tp_methods, kAnalyzerMethods},
+  {0, nullptr}
+};
+
+static PyType_Spec kAnalyzerSpec = {
+  "chartreuse.Analyzer",
+  sizeof(AnalyzerObject),
+  0,
+  Py_TPFLAGS_DEFAULT,
+  kAnalyzerSlots
+};
+
+static PyModuleDef kModule = {
+  PyModuleDef_HEAD_INIT,
+  "chartreuse",
+  "Chartreuse audio descriptors library bindings",
+  -1,
+  nullptr,
+  nullptr,
+  nullptr,
+  nullptr,
+  nullptr
+};
+
+}  // namespace
+
+PyMODINIT_FUNC PyInit_chartreuse(void) {
+  PyObject* const module(PyModule_Create(&kModule));
+  if (module == nullptr) {
+    return nullptr;
+  }
+  PyObject* const manager_type(PyType_FromSpec(&kManagerSpec));
+  PyObject* const analyzer_type(PyType_FromSpec(&kAnalyzerSpec));
+  // References to the types are stolen by the module on success only
+  const bool kManagerAdded((manager_type != nullptr)
+    && (PyModule_AddObject(module, "Manager", manager_type) == 0));
+  if (!kManagerAdded) {
+    Py_XDECREF(manager_type);
+  }
+  const bool kAnalyzerAdded((analyzer_type != nullptr)
+    && (PyModule_AddObject(module, "Analyzer", analyzer_type) == 0));
+  if (!kAnalyzerAdded) {
+    Py_XDECREF(analyzer_type);
+  }
+  bool success(kManagerAdded
+    && kAnalyzerAdded
+    && (PyModule_AddIntConstant(module,
+                                "PITCH_AUTOCORRELATION",
+                                PitchEstimator::kAutoCorrelation) == 0)
+    && (PyModule_AddIntConstant(module,
+                                "PITCH_YIN",
+                                PitchEstimator::kYin) == 0));
+  for (unsigned int desc_idx(0);
+       success && (desc_idx < DescriptorId::kCount);
+       ++desc_idx) {
+    success = (PyModule_AddIntConstant(module,
+                                       kDescriptorNames[desc_idx],
+                                       desc_idx) == 0);
+  }
+  if (!success) {
+    Py_DECREF(module);
+    return nullptr;
+  }
+  return module;
+}
@@ -0,0 +1,85 @@
+/// @file manager_reference.cc
+/// @brief Reference Manager output for the Python module tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// std::size_t
+#include <cstddef>
+// std::ifstream, std::ofstream
+#include <fstream>
+// std::cerr
+#include <iostream>
+// std::vector
+#include <vector>
+
+#include "chartreuse/src/interface/interface_common.h"
+#include "chartreuse/src/interface/manager.h"
+
+using chartreuse::interface::Manager;
+namespace DescriptorId = chartreuse::interface::DescriptorId;
+
+/// @brief Analyse all whole hops of a raw float32 signal file with a default
+/// manager, writing all descriptors of each hop (in identifier order)
+/// into a raw float32 output file
+///
+/// Usage: chartreuse_python_reference <input file> <output file>
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::cerr << "usage: " << argv[0] << " <input file> <output file>\n";
+    return 1;
+  }
+  std::ifstream input_file(argv[1], std::ios::binary | std::ios::ate);
+  if (!input_file) {
+    std::cerr << "cannot read " << argv[1] << "\n";
+    return 1;
+  }
+  std::vector<float> signal(
+    static_cast<std::size_t>(input_file.tellg()) / sizeof(float));
+  input_file.seekg(0);
+  if (!signal.empty()) {
+    input_file.read(reinterpret_cast<char*>(&signal[0]),
+                    signal.size() * sizeof(float));
+  }
+
+  Manager manager((Manager::Parameters()), true);
+  for (unsigned int desc_idx(0); desc_idx < DescriptorId::kCount; ++desc_idx) {
+    manager.EnableDescriptor(static_cast<DescriptorId::Type>(desc_idx), true);
+  }
+  const std::size_t kHopSize(manager.AnalysisParameters().hop_size_sample);
+  std::ofstream output_file(argv[2], std::ios::binary);
+  for (std::size_t index(0);
+       index + kHopSize <= signal.size();
+       index += kHopSize) {
+    manager.ProcessFrame(&signal[index], kHopSize);
+    for (unsigned int desc_idx(0);
+         desc_idx < DescriptorId::kCount;
+         ++desc_idx) {
+      const DescriptorId::Type kDescriptor(
+        static_cast<DescriptorId::Type>(desc_idx));
+      output_file.write(
+        reinterpret_cast<const char*>(manager.GetDescriptor(kDescriptor)),
+        manager.GetDescriptorMeta(kDescriptor).out_dim * sizeof(float));
+    }
+  }
+  if (!output_file.good()) {
+    std::cerr << "cannot write " << argv[2] << "\n";
+    return 1;
+  }
+  return 0;
+}
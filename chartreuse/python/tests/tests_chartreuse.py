@@ -0,0 +1,239 @@
+# @file tests_chartreuse.py
+# @brief Chartreuse Python extension module tests
+# @author gm
+# @copyright gm 2014
+#
+# This file is part of Chartreuse
+#
+# Chartreuse is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Chartreuse is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Usage: tests_chartreuse.py <module directory> <reference executable>
+#
+# Only the standard library is used (array.array buffers), so that these
+# run without NumPy: an explicit out buffer is then always given.
+
+import array
+import math
+import os
+import random
+import subprocess
+import sys
+import tempfile
+import threading
+import unittest
+
+if len(sys.argv) != 3:
+    sys.exit("usage: %s <module directory> <reference executable>"
+             % sys.argv[0])
+sys.path.insert(0, sys.argv[1])
+kReferenceExecutable = sys.argv[2]
+
+import chartreuse  # noqa: E402
+
+kHopSize = 480
+kAvailableDescriptorsCount = 5
+
+
+def WhiteNoise(length, seed=0):
+    """float32 white noise signal of the given length"""
+    generator = random.Random(seed)
+    return array.array('f', (generator.uniform(-1.0, 1.0)
+                             for _ in range(length)))
+
+
+def DescriptorsCount(manager):
+    """Retrieve the descriptors count: identifiers are contiguous"""
+    count = 0
+    while True:
+        try:
+            manager.meta(count)
+        except ValueError:
+            return count
+        count += 1
+
+
+def RowLength(manager, descriptors):
+    return sum(manager.meta(descriptor)[0] for descriptor in descriptors)
+
+
+class ManagerTest(unittest.TestCase):
+
+    def test_process_matches_manager(self):
+        """All descriptors computed through the module have to match
+        a C++ Manager fed hop after hop"""
+        kFramesCount = 24
+        signal = WhiteNoise(kFramesCount * kHopSize)
+        manager = chartreuse.Manager()
+        descriptors = list(range(DescriptorsCount(manager)))
+        kRowLength = RowLength(manager, descriptors)
+        out = array.array('f', bytes(4 * kFramesCount * kRowLength))
+        manager.process(signal, descriptors, out)
+
+        with tempfile.TemporaryDirectory() as directory:
+            input_path = os.path.join(directory, "signal.f32")
+            output_path = os.path.join(directory, "reference.f32")
+            with open(input_path, "wb") as input_file:
+                signal.tofile(input_file)
+            subprocess.check_call([kReferenceExecutable,
+                                   input_path,
+                                   output_path])
+            reference = array.array('f')
+            with open(output_path, "rb") as output_file:
+                reference.frombytes(output_file.read())
+
+        # Rounding may differ (batched accumulations, buffers alignment):
+        # the absolute tolerance is relative to each descriptor range
+        tolerances = []
+        for descriptor in descriptors:
+            dim, out_min, out_max = manager.meta(descriptor)
+            tolerances += [1e-6 * max(1.0, abs(out_min), abs(out_max))] * dim
+        self.assertEqual(len(reference), len(out))
+        for index, (expected, actual) in enumerate(zip(reference, out)):
+            self.assertTrue(math.isclose(expected,
+                                         actual,
+                                         rel_tol=1e-5,
+                                         abs_tol=tolerances[index
+                                                            % kRowLength]),
+                            "row %d column %d: %g != %g"
+                            % (index // kRowLength,
+                               index % kRowLength,
+                               expected,
+                               actual))
+
+    def test_process_returns_out(self):
+        """The given output object itself has to be returned, filled"""
+        kFramesCount = 8
+        manager = chartreuse.Manager()
+        descriptors = [chartreuse.AudioPower, chartreuse.AudioWaveform]
+        out = array.array('f', [-1.0] * (kFramesCount * 3))
+        result = manager.process(WhiteNoise(kFramesCount * kHopSize),
+                                 descriptors,
+                                 out)
+        self.assertIs(out, result)
+        for frame_idx in range(kFramesCount):
+            power, minimum, maximum = out[3 * frame_idx:3 * frame_idx + 3]
+            self.assertGreater(power, 0.0)
+            self.assertLessEqual(minimum, maximum)
+
+    def test_process_rejects_partial_hop(self):
+        """Nothing being held between calls, the signal has to be made of
+        whole hops"""
+        manager = chartreuse.Manager()
+        out = array.array('f', [0.0] * 4)
+        for length in (kHopSize // 2, 3 * kHopSize + 1):
+            with self.assertRaises(ValueError):
+                manager.process(WhiteNoise(length),
+                                [chartreuse.AudioPower],
+                                out)
+
+    def test_process_rejects_float64(self):
+        manager = chartreuse.Manager()
+        signal = array.array('d', [0.0] * kHopSize)
+        out = array.array('f', [0.0])
+        with self.assertRaises(TypeError):
+            manager.process(signal, [chartreuse.AudioPower], out)
+        with self.assertRaises(TypeError):
+            manager.process(array.array('f', signal),
+                            [chartreuse.AudioPower],
+                            array.array('d', [0.0]))
+
+    def test_unknown_descriptor(self):
+        manager = chartreuse.Manager()
+        kCount = DescriptorsCount(manager)
+        self.assertEqual(chartreuse.NormalizedDifference + 1, kCount)
+        signal = WhiteNoise(kHopSize)
+        out = array.array('f', [0.0] * 64)
+        for descriptor in (-1, kCount):
+            with self.assertRaises(ValueError):
+                manager.process(signal, [descriptor], out)
+            with self.assertRaises(ValueError):
+                manager.meta(descriptor)
+            with self.assertRaises(ValueError):
+                manager.gate_hit_count(descriptor)
+        with self.assertRaises(ValueError):
+            manager.process(signal, [], out)
+
+    def test_busy(self):
+        """Processing releases the GIL: any call on the same manager from
+        another thread meanwhile has to raise instead of racing,
+        whichever thread got there first"""
+        kFramesCount = 400
+        manager = chartreuse.Manager()
+        descriptors = list(range(DescriptorsCount(manager)))
+        signal = WhiteNoise(kFramesCount * kHopSize)
+        out = array.array(
+            'f',
+            bytes(4 * kFramesCount * RowLength(manager, descriptors)))
+        probe_signal = WhiteNoise(kHopSize)
+        probe_out = array.array('f', [0.0])
+        done = threading.Event()
+        errors = []
+
+        def Probe():
+            while not done.is_set() and not errors:
+                try:
+                    manager.process(probe_signal,
+                                    [chartreuse.AudioPower],
+                                    probe_out)
+                except RuntimeError as error:
+                    errors.append(error)
+
+        probe = threading.Thread(target=Probe)
+        probe.start()
+        try:
+            # The probe may run only before the long processing starts
+            for _ in range(8):
+                try:
+                    manager.process(signal, descriptors, out)
+                except RuntimeError as error:
+                    # The probe itself was processing
+                    errors.append(error)
+                if errors:
+                    break
+        finally:
+            done.set()
+            probe.join()
+        self.assertTrue(errors)
+        self.assertIn("already processing", str(errors[0]))
+        # The manager is usable again once done
+        manager.process(probe_signal, [chartreuse.AudioPower], probe_out)
+
+
+class AnalyzerTest(unittest.TestCase):
+
+    def test_process_returns_out(self):
+        """The given output object is returned along with the actually
+        computed subframes count, without any slicing copy"""
+        analyzer = chartreuse.Analyzer(48000.0)
+        kLength = 10 * kHopSize + kHopSize // 2
+        out = array.array(
+            'f',
+            [0.0] * ((kLength // kHopSize + 1) * kAvailableDescriptorsCount))
+        result, subframes = analyzer.process(WhiteNoise(kLength), out)
+        self.assertIs(out, result)
+        self.assertGreater(subframes, 0)
+        self.assertLessEqual(subframes, kLength // kHopSize)
+        result, subframes = analyzer.process(array.array('f'), out)
+        self.assertIs(out, result)
+        self.assertEqual(0, subframes)
+
+    def test_process_rejects_float64(self):
+        analyzer = chartreuse.Analyzer(48000.0)
+        with self.assertRaises(TypeError):
+            analyzer.process(array.array('d', [0.0] * kHopSize),
+                             array.array('f', [0.0] * 1024))
+
+
+if __name__ == "__main__":
+    unittest.main(argv=sys.argv[:1])
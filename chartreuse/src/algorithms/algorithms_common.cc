@@ -22,9 +22,13 @@
 
 // std::min, max
 #include <algorithm>
+// std::array
+#include <array>
 // std::log
 #include <cmath>
 
+#include "Eigen/Core"
+
 #include "chartreuse/src/common.h"
 
 namespace chartreuse {
@@ -75,19 +79,38 @@ float ParabolicApproximation(const float* const data,
 
   float min_value(0.0f);
   float arg_min(0);
-  for (unsigned int idx(1); idx < data_length - 1; ++idx) {
-    const float prev(data[idx - 1]);
-    const float peak(data[idx]);
-    const float next(data[idx + 1]);
-    // Looking for peaks:
-    if (peak - prev > 0.0f) {
-      if (next - peak < 0.0f) {
-        const float tmp_argmin(ParabolicArgMin(prev, peak, next) + 1.0f);
-        const float tmp_min(LinearInterpolation(prev, peak, tmp_argmin));
-        if (tmp_min > min_value + threshold) {
-          arg_min = tmp_argmin + idx;
-          min_value = tmp_min;
-        }
+  std::array<bool, kPeakSearchBlockLength> is_peak;
+  std::array<unsigned int, kPeakSearchBlockLength> candidates;
+  for (unsigned int begin(1);
+       begin + 1 < data_length;
+       begin += kPeakSearchBlockLength) {
+    const unsigned int kLength(std::min(kPeakSearchBlockLength,
+                                        data_length - 1 - begin));
+    // Local maxima mask for the whole block at once
+    const Eigen::Map<const Eigen::ArrayXf> kPrev(&data[begin - 1], kLength);
+    const Eigen::Map<const Eigen::ArrayXf> kPeak(&data[begin], kLength);
+    const Eigen::Map<const Eigen::ArrayXf> kNext(&data[begin + 1], kLength);
+    Eigen::Map<Eigen::Array<bool, Eigen::Dynamic, 1> >(&is_peak[0], kLength)
+      = (kPeak - kPrev > 0.0f) && (kNext - kPeak < 0.0f);
+    // Branchless compaction of the peaks positions
+    unsigned int candidates_count(0);
+    for (unsigned int i(0); i < kLength; ++i) {
+      candidates[candidates_count] = begin + i;
+      candidates_count += is_peak[i];
+    }
+    // Parabolic refinement of the survivors only, in order
+    for (unsigned int candidate(0);
+         candidate < candidates_count;
+         ++candidate) {
+      const unsigned int idx(candidates[candidate]);
+      const float prev(data[idx - 1]);
+      const float peak(data[idx]);
+      const float next(data[idx + 1]);
+      const float tmp_argmin(ParabolicArgMin(prev, peak, next) + 1.0f);
+      const float tmp_min(LinearInterpolation(prev, peak, tmp_argmin));
+      if (tmp_min > min_value + threshold) {
+        arg_min = tmp_argmin + idx;
+        min_value = tmp_min;
       }
     }
   }
@@ -44,8 +44,15 @@ float LinearInterpolation(const float left,
 /// estimated by parabolic approximation
 float ParabolicArgMin(const float prev, const float peak, const float next);
 
+/// @brief Block length for the peaks search below
+static const unsigned int kPeakSearchBlockLength(64);
+
 /// @brief Retrieve the maximum position and value of the input buffer
 /// estimated by parabolic approximation
+///
+/// Local maxima are detected a whole block at a time, their positions being
+/// compacted without branching: parabolic refinement is only done
+/// for these survivors.
 float ParabolicApproximation(const float* const data,
                              const unsigned int data_length,
                              const float threshold,
@@ -44,6 +44,21 @@ void Apodizer::ApplyWindow(float* const buffer) const {
   data_map = input.cwiseProduct(internal_data);
 }
 
+void Apodizer::ApplyWindow(const float* const input,
+                           const std::size_t input_length,
+                           float* const output) const {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(input_length <= data_.size());
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(input != output);
+
+  Eigen::Map<Eigen::ArrayXf> output_map(output, data_.size());
+  output_map.head(input_length)
+    = Eigen::Map<const Eigen::ArrayXf>(input, input_length)
+      * Eigen::Map<const Eigen::ArrayXf>(&data_[0], input_length);
+  output_map.tail(data_.size() - input_length).setZero();
+}
+
 void Apodizer::SynthesizeData(const Window::Type type) {
   switch (type) {
     case Window::kRectangular: {
@@ -21,6 +21,8 @@
 #ifndef CHARTREUSE_SRC_ALGORITHMS_APODIZER_H_
 #define CHARTREUSE_SRC_ALGORITHMS_APODIZER_H_
 
+// std::size_t
+#include <cstddef>
 #include <vector>
 
 namespace chartreuse {
@@ -55,6 +57,15 @@ class Apodizer {
   /// @param[in]  buffer    Buffer to apply the window to (of window_length)
   void ApplyWindow(float* const buffer) const;
 
+  /// @brief Same as above, out-of-place, for a zero-padded input
+  ///
+  /// @param[in]  input    Data to apply the window to
+  /// @param[in]  input_length    Input length, the remaining being zeros
+  /// @param[out]  output    Windowed data (of window_length)
+  void ApplyWindow(const float* const input,
+                   const std::size_t input_length,
+                   float* const output) const;
+
  private:
   /// @brief Synthesis method: create the data with all given parameters
   ///
@@ -20,6 +20,9 @@
 
 #include "chartreuse/src/algorithms/autocorrelation.h"
 
+// std::sqrt
+#include <cmath>
+
 #include "Eigen/Core"
 
 #include "chartreuse/src/common.h"
@@ -45,11 +48,12 @@ void AutoCorrelation::operator()(float* const output) {
           output);
 }
 
-void AutoCorrelation::Process(const float* const input,
+template <typename SampleType>
+void AutoCorrelation::Process(const SampleType* const input,
                               const std::size_t input_length,
                               const unsigned int min_lag,
                               const unsigned int max_lag,
-                              float* const output) {
+                              SampleType* const output) {
   CHARTREUSE_ASSERT(input != nullptr);
   CHARTREUSE_ASSERT(input_length > 0);
   CHARTREUSE_ASSERT(min_lag > 0);
@@ -59,20 +63,74 @@ void AutoCorrelation::Process(const float* const input,
   CHARTREUSE_ASSERT(output != nullptr);
   CHARTREUSE_ASSERT(input != output);
 
-  const float kPower(Eigen::Map<const Eigen::VectorXf>(&input[max_lag], input_length - max_lag).cwiseAbs2().sum());
-  const Eigen::Map<const Eigen::VectorXf> right_part(&input[max_lag], input_length - max_lag);
+  typedef Eigen::Matrix<SampleType, Eigen::Dynamic, 1> Vector;
+  const SampleType kZero(static_cast<SampleType>(0));
+  const std::size_t kLength(input_length - max_lag);
+  const Eigen::Map<const Vector> right_part(&input[max_lag], kLength);
+  const SampleType kPower(right_part.cwiseAbs2().sum());
   for (unsigned int lag(min_lag); lag < max_lag; ++lag) {
-    const Eigen::Map<const Eigen::VectorXf> lagged_part(&input[max_lag - lag], input_length - max_lag);
-    const float kCorrPower(right_part.cwiseProduct(lagged_part).sum());
-    const float kLagPower(lagged_part.cwiseAbs2().sum());
-    if (kLagPower != 0.0f) {
-      output[lag - min_lag] = kCorrPower / std::sqrt(kPower * 2.0f * kLagPower);
+    const Eigen::Map<const Vector> lagged_part(&input[max_lag - lag], kLength);
+    const SampleType kCorrPower(right_part.cwiseProduct(lagged_part).sum());
+    const SampleType kLagPower(lagged_part.cwiseAbs2().sum());
+    if (kLagPower != kZero) {
+      output[lag - min_lag] = kCorrPower
+        / std::sqrt(kPower * static_cast<SampleType>(2) * kLagPower);
     } else {
-      output[lag - min_lag] = 0.0f;
+      output[lag - min_lag] = kZero;
     }
   }
 }
 
+template <typename SampleType>
+void AutoCorrelation::Process(const SampleType* const input,
+                              const std::size_t input_length,
+                              const std::size_t frames_count,
+                              const std::size_t frame_stride,
+                              const unsigned int min_lag,
+                              const unsigned int max_lag,
+                              SampleType* const output) {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(frames_count > 0);
+  CHARTREUSE_ASSERT(frame_stride > 0);
+  CHARTREUSE_ASSERT(max_lag > min_lag);
+  CHARTREUSE_ASSERT(output != nullptr);
+
+  const unsigned int kOutputLength(max_lag - min_lag);
+  for (std::size_t frame_idx(0); frame_idx < frames_count; ++frame_idx) {
+    Process(&input[frame_idx * frame_stride],
+            input_length,
+            min_lag,
+            max_lag,
+            &output[frame_idx * kOutputLength]);
+  }
+}
+
+// Explicit instantiations
+template void AutoCorrelation::Process<float>(const float* const input,
+                                              const std::size_t input_length,
+                                              const unsigned int min_lag,
+                                              const unsigned int max_lag,
+                                              float* const output);
+template void AutoCorrelation::Process<double>(const double* const input,
+                                               const std::size_t input_length,
+                                               const unsigned int min_lag,
+                                               const unsigned int max_lag,
+                                               double* const output);
+template void AutoCorrelation::Process<float>(const float* const input,
+                                              const std::size_t input_length,
+                                              const std::size_t frames_count,
+                                              const std::size_t frame_stride,
+                                              const unsigned int min_lag,
+                                              const unsigned int max_lag,
+                                              float* const output);
+template void AutoCorrelation::Process<double>(const double* const input,
+                                               const std::size_t input_length,
+                                               const std::size_t frames_count,
+                                               const std::size_t frame_stride,
+                                               const unsigned int min_lag,
+                                               const unsigned int max_lag,
+                                               double* const output);
+
 descriptors::Descriptor_Meta AutoCorrelation::Meta(void) const {
   return descriptors::Descriptor_Meta(
     manager_->AnalysisParameters().max_lag
@@ -40,11 +40,31 @@ class AutoCorrelation : public descriptors::Descriptor_Interface {
 
   /// @brief Independent process method: this is where the actual computation
   /// is done, to be used in a "raw" way when no manager is available
-  void Process(const float* const input,
-               const std::size_t input_length,
-               const unsigned int min_lag,
-               const unsigned int max_lag,
-               float* const output);
+  ///
+  /// Explicitly instantiated for float and double samples,
+  /// all accumulations being done with the same precision.
+  /// Static since it does not rely on any manager data.
+  template <typename SampleType>
+  static void Process(const SampleType* const input,
+                      const std::size_t input_length,
+                      const unsigned int min_lag,
+                      const unsigned int max_lag,
+                      SampleType* const output);
+
+  /// @brief Batched process method: same as above for frames_count frames,
+  /// the i-th one starting at input[i * frame_stride]
+  ///
+  /// Each frame autocorrelation is written one after the other.
+  /// The lags loop being the inner one, each frame stays in cache
+  /// for its whole computation.
+  template <typename SampleType>
+  static void Process(const SampleType* const input,
+                      const std::size_t input_length,
+                      const std::size_t frames_count,
+                      const std::size_t frame_stride,
+                      const unsigned int min_lag,
+                      const unsigned int max_lag,
+                      SampleType* const output);
 
   descriptors::Descriptor_Meta Meta(void) const;
 
@@ -0,0 +1,164 @@
+/// @file constantqkernel.cc
+/// @brief Constant-Q transform spectral kernel implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/constantqkernel.h"
+
+// std::max, std::min
+#include <algorithm>
+// std::abs, std::cos, std::pow, std::sin
+#include <cmath>
+// std::free
+#include <cstdlib>
+
+#include "Eigen/Core"
+
+#include "externals/kiss_fft/kiss_fft.h"
+
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/algorithms/algorithms_common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+ConstantQKernel::ConstantQKernel(const float min_freq,
+                                 const unsigned int bins_per_octave,
+                                 const unsigned int bins_count,
+                                 const unsigned int max_kernel_length,
+                                 const unsigned int kernel_center,
+                                 const unsigned int dft_length,
+                                 const float sampling_freq,
+                                 const float threshold)
+    : starts_(bins_count),
+      lengths_(bins_count),
+      offsets_(bins_count),
+      weights_() {
+  CHARTREUSE_ASSERT(min_freq > 0.0f);
+  CHARTREUSE_ASSERT(bins_per_octave > 0);
+  CHARTREUSE_ASSERT(bins_count > 0);
+  CHARTREUSE_ASSERT(max_kernel_length > 0);
+  CHARTREUSE_ASSERT(max_kernel_length <= dft_length);
+  CHARTREUSE_ASSERT(kernel_center < dft_length);
+  CHARTREUSE_ASSERT(IsPowerOfTwo(dft_length));
+  CHARTREUSE_ASSERT(sampling_freq > 0.0f);
+  CHARTREUSE_ASSERT(threshold >= 0.0f);
+  CHARTREUSE_ASSERT(threshold < 1.0f);
+  SynthesizeData(min_freq,
+                 bins_per_octave,
+                 max_kernel_length,
+                 kernel_center,
+                 dft_length,
+                 sampling_freq,
+                 threshold);
+}
+
+void ConstantQKernel::Apply(const float* const spectrum,
+                            float* const output) const {
+  CHARTREUSE_ASSERT(spectrum != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrum != output);
+
+  const std::complex<float>* const kSpectrum(
+    reinterpret_cast<const std::complex<float>*>(spectrum));
+  for (unsigned int bin(0); bin < BinsCount(); ++bin) {
+    const Eigen::Map<const Eigen::VectorXcf> kData(&kSpectrum[starts_[bin]],
+                                                   lengths_[bin]);
+    const Eigen::Map<const Eigen::VectorXcf> kWeights(&weights_[offsets_[bin]],
+                                                      lengths_[bin]);
+    output[bin] = std::abs(kData.cwiseProduct(kWeights).sum());
+  }
+}
+
+unsigned int ConstantQKernel::BinsCount(void) const {
+  return static_cast<unsigned int>(starts_.size());
+}
+
+void ConstantQKernel::SynthesizeData(const float min_freq,
+                                     const unsigned int bins_per_octave,
+                                     const unsigned int max_kernel_length,
+                                     const unsigned int kernel_center,
+                                     const unsigned int dft_length,
+                                     const float sampling_freq,
+                                     const float threshold) {
+  const unsigned int kSpectrumLength(dft_length / 2 + 1);
+  const double kQ(1.0 / (std::pow(2.0, 1.0 / bins_per_octave) - 1.0));
+  const double kTwoPi(2.0 * 3.14159265358979323846);
+  kiss_fft_cfg config(kiss_fft_alloc(dft_length, 0, NULL, NULL));
+  CHARTREUSE_ASSERT(config != NULL);
+  std::vector<kiss_fft_cpx> temporal(dft_length);
+  std::vector<kiss_fft_cpx> spectral(dft_length);
+  for (unsigned int bin(0); bin < BinsCount(); ++bin) {
+    const double kFreq(min_freq
+                       * std::pow(2.0, static_cast<double>(bin)
+                                       / bins_per_octave));
+    offsets_[bin] = static_cast<unsigned int>(weights_.size());
+    if (kFreq >= sampling_freq / 2.0) {
+      // Above Nyquist: null output
+      starts_[bin] = 0;
+      lengths_[bin] = 0;
+      continue;
+    }
+    const unsigned int kLength(std::max(2u, std::min(max_kernel_length,
+      static_cast<unsigned int>(kQ * sampling_freq / kFreq))));
+    // Kernel begins so that it is centered on kernel_center, within the frame
+    const unsigned int kBegin(std::min(
+      static_cast<unsigned int>(std::max(0, static_cast<int>(kernel_center)
+                                            - static_cast<int>(kLength / 2))),
+      dft_length - kLength));
+    // Windowed complex exponential, normalized by its length
+    std::fill(temporal.begin(), temporal.end(), kiss_fft_cpx());
+    for (unsigned int i(0); i < kLength; ++i) {
+      const double kWindow((0.54 - 0.46 * std::cos(kTwoPi * i / (kLength - 1)))
+                           / kLength);
+      const double kPhase(kTwoPi * kFreq * i / sampling_freq);
+      temporal[kBegin + i].r = static_cast<float>(kWindow * std::cos(kPhase));
+      temporal[kBegin + i].i = static_cast<float>(kWindow * std::sin(kPhase));
+    }
+    kiss_fft(config, &temporal[0], &spectral[0]);
+
+    // Only the coefficients above the threshold are kept:
+    // by Parseval, bin = sum(X * conj(K)) / N
+    float max_magnitude(0.0f);
+    for (unsigned int i(0); i < kSpectrumLength; ++i) {
+      const std::complex<float> kValue(spectral[i].r, spectral[i].i);
+      max_magnitude = std::max(max_magnitude, std::abs(kValue));
+    }
+    const float kThreshold(threshold * max_magnitude);
+    unsigned int first(kSpectrumLength);
+    unsigned int last(0);
+    for (unsigned int i(0); i < kSpectrumLength; ++i) {
+      const std::complex<float> kValue(spectral[i].r, spectral[i].i);
+      if (std::abs(kValue) >= kThreshold) {
+        first = std::min(first, i);
+        last = i;
+      }
+    }
+    CHARTREUSE_ASSERT(first <= last);
+    starts_[bin] = first;
+    lengths_[bin] = last - first + 1;
+    for (unsigned int i(first); i <= last; ++i) {
+      weights_.push_back(std::complex<float>(spectral[i].r, -spectral[i].i)
+                         / static_cast<float>(dft_length));
+    }
+  }
+  std::free(config);
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
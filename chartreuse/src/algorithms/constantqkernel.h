@@ -0,0 +1,92 @@
+/// @file constantqkernel.h
+/// @brief Constant-Q transform spectral kernel declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_CONSTANTQKERNEL_H_
+#define CHARTREUSE_SRC_ALGORITHMS_CONSTANTQKERNEL_H_
+
+#include <complex>
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Constant-Q transform spectral kernel (Brown - Puckette):
+/// each constant-Q bin is computed as the product of the Dft of the frame
+/// with the Dft of its (windowed, complex exponential) temporal kernel.
+///
+/// These spectral kernels are concentrated around their center frequency:
+/// all coefficients lower than a threshold relatively to their maximum are
+/// discarded, hence each row is stored as a sparse one
+/// (start bin, length, complex weights).
+///
+/// The temporal kernels are centered on the given position of the frame.
+/// Their length is bounded by the given maximum: below the frequency for
+/// which the constant-Q length exceeds it the frequency resolution is
+/// the one of this maximum length instead.
+class ConstantQKernel {
+ public:
+  /// @brief Default constructor, synthesizes all kernels
+  ///
+  /// @param[in]  min_freq   Center frequency of the first bin
+  /// @param[in]  bins_per_octave   Frequency resolution
+  /// @param[in]  bins_count   Number of constant-Q bins
+  /// @param[in]  max_kernel_length   Maximum temporal kernel length
+  /// @param[in]  kernel_center   Temporal kernels center within the frame
+  /// @param[in]  dft_length   Length of the Dft the spectrum comes from
+  /// @param[in]  sampling_freq   Analysis sampling frequency
+  /// @param[in]  threshold   Relative threshold for spectral coefficients
+  explicit ConstantQKernel(const float min_freq,
+                           const unsigned int bins_per_octave,
+                           const unsigned int bins_count,
+                           const unsigned int max_kernel_length,
+                           const unsigned int kernel_center,
+                           const unsigned int dft_length,
+                           const float sampling_freq,
+                           const float threshold);
+
+  /// @brief Apply the kernel on the given spectrum, retrieve magnitudes
+  ///
+  /// @param[in]  spectrum   Interleaved complex spectrum, of (dft_length + 2)
+  /// @param[out]  output   Constant-Q bins magnitudes, of BinsCount()
+  void Apply(const float* const spectrum, float* const output) const;
+
+  /// @brief Number of constant-Q bins
+  unsigned int BinsCount(void) const;
+
+ private:
+  /// @brief Synthesis method: create the kernels with all given parameters
+  void SynthesizeData(const float min_freq,
+                      const unsigned int bins_per_octave,
+                      const unsigned int max_kernel_length,
+                      const unsigned int kernel_center,
+                      const unsigned int dft_length,
+                      const float sampling_freq,
+                      const float threshold);
+
+  std::vector<unsigned int> starts_;  ///< First bin of each row
+  std::vector<unsigned int> lengths_;  ///< Bins count of each row
+  std::vector<unsigned int> offsets_;  ///< Each row offset in weights_
+  std::vector<std::complex<float> > weights_;  ///< All rows weights, packed
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_CONSTANTQKERNEL_H_
@@ -0,0 +1,76 @@
+/// @file dct.cc
+/// @brief Cached Discrete Cosine Transform implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/dct.h"
+
+// std::cos, std::sqrt
+#include <cmath>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+Dct::Dct(const unsigned int input_length,
+         const unsigned int output_length)
+    : input_length_(input_length),
+      output_length_(output_length),
+      matrix_(input_length * output_length) {
+  CHARTREUSE_ASSERT(input_length > 0);
+  CHARTREUSE_ASSERT(output_length > 0);
+  CHARTREUSE_ASSERT(output_length <= input_length);
+  const double kPi(3.14159265358979323846);
+  for (unsigned int k(0); k < output_length_; ++k) {
+    const double kScaling(std::sqrt(((k == 0) ? 1.0 : 2.0) / input_length_));
+    for (unsigned int n(0); n < input_length_; ++n) {
+      matrix_[k * input_length_ + n] = static_cast<float>(
+        kScaling * std::cos(kPi * k * (2.0 * n + 1.0) / (2.0 * input_length_)));
+    }
+  }
+}
+
+void Dct::Apply(const float* const input, float* const output) const {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(input != output);
+
+  typedef Eigen::Matrix<float,
+                        Eigen::Dynamic,
+                        Eigen::Dynamic,
+                        Eigen::RowMajor> RowMajorMatrix;
+  const Eigen::Map<const RowMajorMatrix> kMatrix(&matrix_[0],
+                                                 output_length_,
+                                                 input_length_);
+  Eigen::Map<Eigen::VectorXf>(output, output_length_).noalias()
+    = kMatrix * Eigen::Map<const Eigen::VectorXf>(input, input_length_);
+}
+
+unsigned int Dct::InputLength(void) const {
+  return input_length_;
+}
+
+unsigned int Dct::OutputLength(void) const {
+  return output_length_;
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
@@ -0,0 +1,64 @@
+/// @file dct.h
+/// @brief Cached Discrete Cosine Transform declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_DCT_H_
+#define CHARTREUSE_SRC_ALGORITHMS_DCT_H_
+
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Orthonormal DCT-II, truncated to its first coefficients
+///
+/// Input lengths here are small (a few dozens of filter bank bands),
+/// hence the transform is a precomputed matrix product rather than a
+/// fast algorithm.
+class Dct {
+ public:
+  /// @brief Default constructor, synthesizes the transform matrix
+  ///
+  /// @param[in]  input_length   Length of the input vector
+  /// @param[in]  output_length   Number of coefficients to compute
+  explicit Dct(const unsigned int input_length,
+               const unsigned int output_length);
+
+  /// @brief Apply the transform on the given input
+  ///
+  /// @param[in]  input   Input vector, of InputLength()
+  /// @param[out]  output   First coefficients, of OutputLength()
+  void Apply(const float* const input, float* const output) const;
+
+  /// @brief Length of the input vector
+  unsigned int InputLength(void) const;
+
+  /// @brief Number of computed coefficients
+  unsigned int OutputLength(void) const;
+
+ private:
+  const unsigned int input_length_;
+  const unsigned int output_length_;
+  std::vector<float> matrix_;  ///< Row-major transform matrix
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_DCT_H_
@@ -23,9 +23,14 @@
 #include <cmath>
 
 #include <algorithm>
+// std::complex
+#include <complex>
+
+#include "Eigen/Core"
 
 #include "chartreuse/src/common.h"
 #include "chartreuse/src/algorithms/algorithms_common.h"
+#include "chartreuse/src/interface/analysiscontext.h"
 #include "chartreuse/src/interface/manager.h"
 
 namespace chartreuse {
@@ -33,10 +38,8 @@ namespace algorithms {
 
 DftPower::DftPower(interface::Manager* manager)
     : Descriptor_Interface(manager),
-      // TODO(gm): remove the magic, replace it by actual norm computation
       normalization_factor_(2.0f
-                            / (manager_->AnalysisParameters().dft_length
-                            * 571.865f)) {
+                            / manager_->Context().SpectrumNormalization()) {
   CHARTREUSE_ASSERT(normalization_factor_ > 0.0f);
 }
 
@@ -64,6 +67,31 @@ void DftPower::Process(const float* const input,
   }
 }
 
+void DftPower::Process(const float* const input,
+                       const std::size_t input_length,
+                       const std::size_t frames_count,
+                       const std::size_t frame_stride,
+                       float* const output) {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(input_length > 0);
+  CHARTREUSE_ASSERT(input_length % 2 == 0);
+  CHARTREUSE_ASSERT(frames_count > 0);
+  CHARTREUSE_ASSERT(frame_stride >= input_length);
+  CHARTREUSE_ASSERT(frame_stride % 2 == 0);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(input != output);
+
+  // One column of complex bins per Dft
+  const std::size_t kBinsCount(input_length / 2);
+  const Eigen::Map<const Eigen::ArrayXXcf, 0, Eigen::OuterStride<> > bins(
+    reinterpret_cast<const std::complex<float>*>(input),
+    kBinsCount,
+    frames_count,
+    Eigen::OuterStride<>(frame_stride / 2));
+  Eigen::Map<Eigen::ArrayXXf> powers(output, kBinsCount, frames_count);
+  powers = bins.abs2() * normalization_factor_;
+}
+
 descriptors::Descriptor_Meta DftPower::Meta(void) const {
   return descriptors::Descriptor_Meta(
     // Only real data
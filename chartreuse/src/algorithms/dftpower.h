@@ -43,6 +43,17 @@ class DftPower : public descriptors::Descriptor_Interface {
                const std::size_t input_length,
                float* const output);
 
+  /// @brief Batched process method: same as above for frames_count Dfts,
+  /// the i-th one starting at input[i * frame_stride]
+  ///
+  /// frame_stride has to be even (complex data),
+  /// power spectra are written one after the other.
+  void Process(const float* const input,
+               const std::size_t input_length,
+               const std::size_t frames_count,
+               const std::size_t frame_stride,
+               float* const output);
+
   descriptors::Descriptor_Meta Meta(void) const;
 
  private:
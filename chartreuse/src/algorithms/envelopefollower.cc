@@ -0,0 +1,161 @@
+/// @file envelopefollower.cc
+/// @brief Streaming envelope follower implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/envelopefollower.h"
+
+// std::min
+#include <algorithm>
+// std::ceil, std::exp, std::log10, std::pow
+#include <cmath>
+
+#include "chartreuse/src/algorithms/algorithms_common.h"
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+EnvelopeFollower::EnvelopeFollower(const float attack_time,
+                                   const float release_time,
+                                   const float frame_duration)
+    : attack_coeff_(std::exp(-frame_duration / attack_time)),
+      release_coeff_(std::exp(-frame_duration / release_time)),
+      envelope_(0.0f) {
+  CHARTREUSE_ASSERT(attack_time > 0.0f);
+  CHARTREUSE_ASSERT(release_time > 0.0f);
+  CHARTREUSE_ASSERT(frame_duration > 0.0f);
+}
+
+float EnvelopeFollower::Process(const float input) {
+  const float kCoeff(input > envelope_ ? attack_coeff_ : release_coeff_);
+  envelope_ = input + kCoeff * (envelope_ - input);
+  return envelope_;
+}
+
+void EnvelopeFollower::Reset(void) {
+  envelope_ = 0.0f;
+}
+
+void EnvelopeFollower::CopyState(const EnvelopeFollower& other) {
+  CHARTREUSE_ASSERT(attack_coeff_ == other.attack_coeff_);
+  CHARTREUSE_ASSERT(release_coeff_ == other.release_coeff_);
+  envelope_ = other.envelope_;
+}
+
+AttackTracker::AttackTracker(const float floor,
+                             const float ceiling,
+                             const unsigned int levels_per_decade,
+                             const float frame_duration)
+    : floor_(floor),
+      levels_per_decade_(static_cast<float>(levels_per_decade)),
+      frame_duration_(frame_duration),
+      crossing_times_(static_cast<std::size_t>(std::ceil(
+        std::log10(ceiling / floor) * levels_per_decade)) + 1),
+      crossed_count_(0),
+      frame_idx_(0),
+      previous_(0.0f),
+      maximum_(0.0f),
+      maximum_time_(0.0f) {
+  CHARTREUSE_ASSERT(floor > 0.0f);
+  CHARTREUSE_ASSERT(ceiling > floor);
+  CHARTREUSE_ASSERT(levels_per_decade > 0);
+  CHARTREUSE_ASSERT(frame_duration > 0.0f);
+}
+
+void AttackTracker::Push(const float envelope) {
+  CHARTREUSE_ASSERT(envelope >= 0.0f);
+
+  const float kTime(static_cast<float>(frame_idx_) * frame_duration_);
+  // Levels are crossed in order: only the next ones have to be checked
+  while ((crossed_count_ < crossing_times_.size())
+         && (envelope >= Level(static_cast<unsigned int>(crossed_count_)))) {
+    const float kLevel(Level(static_cast<unsigned int>(crossed_count_)));
+    // The previous value was below this level, by construction
+    const float kRatio((kLevel - previous_) / (envelope - previous_));
+    crossing_times_[crossed_count_] = kTime - (1.0f - kRatio) * frame_duration_;
+    crossed_count_ += 1;
+  }
+  if (envelope > maximum_) {
+    maximum_ = envelope;
+    maximum_time_ = kTime;
+  }
+  previous_ = envelope;
+  frame_idx_ += 1;
+}
+
+float AttackTracker::CrossingTime(const float ratio) const {
+  CHARTREUSE_ASSERT(ratio > 0.0f);
+  CHARTREUSE_ASSERT(ratio <= 1.0f);
+
+  const float kThreshold(ratio * maximum_);
+  if ((crossed_count_ == 0) || (kThreshold <= floor_)) {
+    return crossed_count_ == 0 ? maximum_time_ : crossing_times_[0];
+  }
+  // Ladder levels right below and above the threshold
+  const std::size_t kBelowIdx(std::min(
+    static_cast<std::size_t>(std::log10(kThreshold / floor_)
+                             * levels_per_decade_),
+    crossed_count_ - 1));
+  const float kBelowLevel(Level(static_cast<unsigned int>(kBelowIdx)));
+  const bool kAboveCrossed(kBelowIdx + 1 < crossed_count_);
+  // If the level above was never reached, the maximum stands for it
+  const float kAboveLevel(kAboveCrossed ?
+                          Level(static_cast<unsigned int>(kBelowIdx + 1))
+                          : maximum_);
+  const float kAboveTime(kAboveCrossed ?
+                         crossing_times_[kBelowIdx + 1]
+                         : maximum_time_);
+  if (kAboveLevel <= kBelowLevel) {
+    return crossing_times_[kBelowIdx];
+  }
+  const float kRatio(std::min(1.0f, (kThreshold - kBelowLevel)
+                                    / (kAboveLevel - kBelowLevel)));
+  return LinearInterpolation(crossing_times_[kBelowIdx], kAboveTime, kRatio);
+}
+
+float AttackTracker::MaximumTime(void) const {
+  return maximum_time_;
+}
+
+void AttackTracker::Reset(void) {
+  crossed_count_ = 0;
+  frame_idx_ = 0;
+  previous_ = 0.0f;
+  maximum_ = 0.0f;
+  maximum_time_ = 0.0f;
+}
+
+void AttackTracker::CopyState(const AttackTracker& other) {
+  CHARTREUSE_ASSERT(crossing_times_.size() == other.crossing_times_.size());
+  // Same length: no reallocation here
+  crossing_times_ = other.crossing_times_;
+  crossed_count_ = other.crossed_count_;
+  frame_idx_ = other.frame_idx_;
+  previous_ = other.previous_;
+  maximum_ = other.maximum_;
+  maximum_time_ = other.maximum_time_;
+}
+
+float AttackTracker::Level(const unsigned int level_idx) const {
+  return floor_ * std::pow(10.0f,
+                           static_cast<float>(level_idx) / levels_per_decade_);
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
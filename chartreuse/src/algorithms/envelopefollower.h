@@ -0,0 +1,117 @@
+/// @file envelopefollower.h
+/// @brief Streaming envelope follower declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_ENVELOPEFOLLOWER_H_
+#define CHARTREUSE_SRC_ALGORITHMS_ENVELOPEFOLLOWER_H_
+
+// std::size_t
+#include <cstddef>
+// std::vector
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Envelope follower: one-pole smoothing filter with distinct
+/// attack and release time constants, fed with one value per frame
+class EnvelopeFollower {
+ public:
+  /// @brief Default constructor
+  ///
+  /// @param[in]  attack_time   Attack time constant, in seconds
+  /// @param[in]  release_time   Release time constant, in seconds
+  /// @param[in]  frame_duration   Duration between two inputs, in seconds
+  explicit EnvelopeFollower(const float attack_time,
+                            const float release_time,
+                            const float frame_duration);
+
+  /// @brief Update the envelope with the next input value
+  ///
+  /// @return The envelope value for this input
+  float Process(const float input);
+
+  /// @brief Set the envelope back to zero
+  void Reset(void);
+
+  /// @brief Copy the given follower state, built with the same parameters
+  void CopyState(const EnvelopeFollower& other);
+
+ private:
+  const float attack_coeff_;
+  const float release_coeff_;
+  float envelope_;
+};
+
+/// @brief Attack tracker: streaming retrieval of the attack start and stop
+/// times of an envelope, without buffering it
+///
+/// Start and stop times are the first instants the envelope reaches given
+/// ratios of its maximum. Since the maximum is only known afterwards, the
+/// first crossing time of a fixed logarithmic levels ladder is saved
+/// instead, hence a constant memory footprint. Crossing times are linearly
+/// interpolated between frames, then between ladder levels.
+class AttackTracker {
+ public:
+  /// @brief Default constructor
+  ///
+  /// @param[in]  floor   Lowest tracked level, has to be strictly positive
+  /// @param[in]  ceiling   Highest tracked level
+  /// @param[in]  levels_per_decade   Ladder resolution
+  /// @param[in]  frame_duration   Duration between two inputs, in seconds
+  explicit AttackTracker(const float floor,
+                         const float ceiling,
+                         const unsigned int levels_per_decade,
+                         const float frame_duration);
+
+  /// @brief Update the tracker with the next envelope value
+  void Push(const float envelope);
+
+  /// @brief Retrieve the first time the envelope reached the given ratio
+  /// of its maximum, in seconds since the last reset
+  float CrossingTime(const float ratio) const;
+
+  /// @brief Retrieve the time at which the maximum was reached
+  float MaximumTime(void) const;
+
+  /// @brief Forget everything about the previous envelope
+  void Reset(void);
+
+  /// @brief Copy the given tracker state, built with the same parameters
+  void CopyState(const AttackTracker& other);
+
+ private:
+  /// @brief Retrieve the ladder level value given its index
+  float Level(const unsigned int level_idx) const;
+
+  const float floor_;
+  const float levels_per_decade_;
+  const float frame_duration_;
+  std::vector<float> crossing_times_;  ///< First crossing time of each level
+  std::size_t crossed_count_;  ///< How many levels were crossed so far
+  std::size_t frame_idx_;
+  float previous_;  ///< Previous envelope value
+  float maximum_;
+  float maximum_time_;
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_ENVELOPEFOLLOWER_H_
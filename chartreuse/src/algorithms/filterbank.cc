@@ -0,0 +1,159 @@
+/// @file filterbank.cc
+/// @brief Sparse spectral filter bank implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/filterbank.h"
+
+// std::min, std::max
+#include <algorithm>
+// std::ceil, std::floor, std::log10, std::pow
+#include <cmath>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Convert a frequency in Hz to the given warped scale
+static float Warp(const Bands::Type type, const float freq) {
+  switch (type) {
+    case Bands::kMel: {
+      // HTK formula
+      return 2595.0f * std::log10(1.0f + freq / 700.0f);
+    }
+    case Bands::kBark: {
+      // Traunmuller formula
+      return 26.81f * freq / (1960.0f + freq) - 0.53f;
+    }
+    default: {
+      // Should never happen
+      CHARTREUSE_ASSERT(false);
+      return 0.0f;
+    }
+  }
+}
+
+/// @brief Convert a value on the given warped scale back into Hz
+static float Unwarp(const Bands::Type type, const float value) {
+  switch (type) {
+    case Bands::kMel: {
+      return 700.0f * (std::pow(10.0f, value / 2595.0f) - 1.0f);
+    }
+    case Bands::kBark: {
+      return 1960.0f * (value + 0.53f) / (26.28f - value);
+    }
+    default: {
+      // Should never happen
+      CHARTREUSE_ASSERT(false);
+      return 0.0f;
+    }
+  }
+}
+
+FilterBank::FilterBank(const Bands::Type type,
+                       const unsigned int bands_count,
+                       const unsigned int dft_length,
+                       const float sampling_freq,
+                       const float low_freq,
+                       const float high_freq)
+    : starts_(bands_count),
+      lengths_(bands_count),
+      offsets_(bands_count),
+      weights_() {
+  CHARTREUSE_ASSERT(bands_count > 0);
+  CHARTREUSE_ASSERT(dft_length > 0);
+  CHARTREUSE_ASSERT(sampling_freq > 0.0f);
+  CHARTREUSE_ASSERT(low_freq >= 0.0f);
+  CHARTREUSE_ASSERT(high_freq > low_freq);
+  CHARTREUSE_ASSERT(high_freq <= sampling_freq / 2.0f);
+  SynthesizeData(type, dft_length, sampling_freq, low_freq, high_freq);
+}
+
+void FilterBank::Apply(const float* const spectrum_power,
+                       float* const output) const {
+  CHARTREUSE_ASSERT(spectrum_power != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrum_power != output);
+
+  for (unsigned int band(0); band < starts_.size(); ++band) {
+    const Eigen::Map<const Eigen::VectorXf> kPower(&spectrum_power[starts_[band]],
+                                                   lengths_[band]);
+    const Eigen::Map<const Eigen::VectorXf> kWeights(&weights_[offsets_[band]],
+                                                     lengths_[band]);
+    output[band] = kPower.dot(kWeights);
+  }
+}
+
+unsigned int FilterBank::BandsCount(void) const {
+  return static_cast<unsigned int>(starts_.size());
+}
+
+void FilterBank::SynthesizeData(const Bands::Type type,
+                                const unsigned int dft_length,
+                                const float sampling_freq,
+                                const float low_freq,
+                                const float high_freq) {
+  const unsigned int kBandsCount(BandsCount());
+  const unsigned int kSpectrumLength(dft_length / 2 + 1);
+  const float kBinWidth(sampling_freq / dft_length);
+  const float kLowWarped(Warp(type, low_freq));
+  const float kWarpedStep((Warp(type, high_freq) - kLowWarped)
+                          / (kBandsCount + 1));
+  for (unsigned int band(0); band < kBandsCount; ++band) {
+    const float kLeft(Unwarp(type, kLowWarped + band * kWarpedStep));
+    const float kCenter(Unwarp(type, kLowWarped + (band + 1) * kWarpedStep));
+    const float kRight(Unwarp(type, kLowWarped + (band + 2) * kWarpedStep));
+    // All bins strictly within ]left ; right[
+    const unsigned int kFirst(static_cast<unsigned int>(
+      std::floor(kLeft / kBinWidth)) + 1);
+    const unsigned int kLast(std::min(
+      static_cast<unsigned int>(std::ceil(kRight / kBinWidth)) - 1,
+      kSpectrumLength - 1));
+    offsets_[band] = static_cast<unsigned int>(weights_.size());
+    if (kLast < kFirst) {
+      // Filter narrower than one bin: use the nearest one
+      starts_[band] = std::min(
+        static_cast<unsigned int>(kCenter / kBinWidth + 0.5f),
+        kSpectrumLength - 1);
+      lengths_[band] = 1;
+      weights_.push_back(1.0f);
+      continue;
+    }
+    starts_[band] = kFirst;
+    lengths_[band] = kLast - kFirst + 1;
+    float weights_sum(0.0f);
+    for (unsigned int bin(kFirst); bin <= kLast; ++bin) {
+      const float kFreq(bin * kBinWidth);
+      const float kWeight(std::max(0.0f,
+        (kFreq < kCenter) ? (kFreq - kLeft) / (kCenter - kLeft)
+                          : (kRight - kFreq) / (kRight - kCenter)));
+      weights_.push_back(kWeight);
+      weights_sum += kWeight;
+    }
+    CHARTREUSE_ASSERT(weights_sum > 0.0f);
+    for (unsigned int i(0); i < lengths_[band]; ++i) {
+      weights_[offsets_[band] + i] /= weights_sum;
+    }
+  }
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
@@ -0,0 +1,89 @@
+/// @file filterbank.h
+/// @brief Sparse spectral filter bank declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_FILTERBANK_H_
+#define CHARTREUSE_SRC_ALGORITHMS_FILTERBANK_H_
+
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Filter bank frequency warping type
+// Using the namespace trick...
+namespace Bands {
+enum Type {
+  kMel = 0,
+  kBark,
+  kCount
+};
+}
+
+/// @brief Filter bank: triangular filters, equally spaced on a warped
+/// frequency scale, applied on a power spectrum.
+///
+/// Each filter only spans a few contiguous bins, hence it is stored
+/// as a sparse row (start bin, length, weights); applying the bank is a
+/// sparse matrix-vector product where each row is a dense dot product.
+/// All filters are normalized so that their weights sum to 1.
+class FilterBank {
+ public:
+  /// @brief Default constructor, synthesizes all filters
+  ///
+  /// @param[in]  type   Frequency warping of the filters
+  /// @param[in]  bands_count   Number of filters
+  /// @param[in]  dft_length   Length of the Dft the spectrum comes from
+  /// @param[in]  sampling_freq   Analysis sampling frequency
+  /// @param[in]  low_freq   Lower edge of the first filter
+  /// @param[in]  high_freq   Higher edge of the last filter
+  explicit FilterBank(const Bands::Type type,
+                      const unsigned int bands_count,
+                      const unsigned int dft_length,
+                      const float sampling_freq,
+                      const float low_freq,
+                      const float high_freq);
+
+  /// @brief Apply the filter bank on the given power spectrum
+  ///
+  /// @param[in]  spectrum_power   Power spectrum, of (dft_length / 2 + 1)
+  /// @param[out]  output   Filters output, of BandsCount()
+  void Apply(const float* const spectrum_power, float* const output) const;
+
+  /// @brief Number of filters
+  unsigned int BandsCount(void) const;
+
+ private:
+  /// @brief Synthesis method: create the filters with all given parameters
+  void SynthesizeData(const Bands::Type type,
+                      const unsigned int dft_length,
+                      const float sampling_freq,
+                      const float low_freq,
+                      const float high_freq);
+
+  std::vector<unsigned int> starts_;  ///< First bin of each filter
+  std::vector<unsigned int> lengths_;  ///< Bins count of each filter
+  std::vector<unsigned int> offsets_;  ///< Each filter offset in weights_
+  std::vector<float> weights_;  ///< All filters weights, packed
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_FILTERBANK_H_
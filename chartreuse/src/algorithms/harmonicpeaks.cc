@@ -0,0 +1,162 @@
+/// @file harmonicpeaks.cc
+/// @brief Harmonic peaks extraction implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/harmonicpeaks.h"
+
+// std::fill, std::max, std::min
+#include <algorithm>
+// std::floor, std::sqrt
+#include <cmath>
+// std::ptrdiff_t
+#include <cstddef>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/algorithms/algorithms_common.h"
+#include "chartreuse/src/algorithms/workspace.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+unsigned int HarmonicsCount(const float* const harmonic_peaks) {
+  CHARTREUSE_ASSERT(harmonic_peaks != nullptr);
+  return static_cast<unsigned int>(harmonic_peaks[0]);
+}
+
+const float* HarmonicPeakData(const float* const harmonic_peaks,
+                              const unsigned int harmonic) {
+  CHARTREUSE_ASSERT(harmonic_peaks != nullptr);
+  CHARTREUSE_ASSERT(harmonic < kMaxHarmonicsCount);
+  return &harmonic_peaks[1 + harmonic * HarmonicPeak::kCount];
+}
+
+HarmonicPeaks::HarmonicPeaks(interface::Manager* manager)
+    : Descriptor_Interface(manager) {
+  // Nothing to do here for now
+}
+
+void HarmonicPeaks::operator()(float* const output) {
+  const float kAFF(*manager_->GetDescriptor(
+    interface::DescriptorId::kAudioFundamentalFrequency));
+  Process(manager_->GetDescriptor(interface::DescriptorId::kSpectrogramPower),
+          manager_->AnalysisParameters().dft_length / 2 + 1,
+          kAFF,
+          manager_->AnalysisParameters().sampling_freq,
+          output);
+}
+
+void HarmonicPeaks::Process(const float* const spectrogram_power,
+                            const unsigned int spectrum_length,
+                            const float estimated_lag,
+                            const float sampling_freq,
+                            float* const output) {
+  CHARTREUSE_ASSERT(spectrogram_power != nullptr);
+  CHARTREUSE_ASSERT(spectrum_length > 2);
+  CHARTREUSE_ASSERT(estimated_lag >= 1.0f);
+  CHARTREUSE_ASSERT(sampling_freq > 0.0f);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrogram_power != output);
+
+  // Local maxima detection, the power of any other bin is zeroed out
+  const unsigned int kInnerLength(spectrum_length - 2);
+  const Eigen::Map<const Eigen::ArrayXf> kPrev(&spectrogram_power[0],
+                                               kInnerLength);
+  const Eigen::Map<const Eigen::ArrayXf> kPeak(&spectrogram_power[1],
+                                               kInnerLength);
+  const Eigen::Map<const Eigen::ArrayXf> kNext(&spectrogram_power[2],
+                                               kInnerLength);
+  Workspace::Scope scope(&manager_->Scratch());
+  float* const peaks_power(scope.Floats(spectrum_length));
+  peaks_power[0] = 0.0f;
+  peaks_power[spectrum_length - 1] = 0.0f;
+  Eigen::Map<Eigen::ArrayXf>(&peaks_power[1], kInnerLength)
+    = ((kPeak > kPrev) && (kPeak >= kNext)).select(kPeak, 0.0f);
+
+  // Highest peak within each harmonic search window
+  const float kBinWidth(sampling_freq / (2.0f * (spectrum_length - 1)));
+  const float kFundamental(sampling_freq / estimated_lag);
+  const float kHalfWidth(std::max(1.0f,
+                                  kHarmonicTolerance * kFundamental / kBinWidth));
+  unsigned int harmonics_count(0);
+  while (harmonics_count < kMaxHarmonicsCount) {
+    const float kExpectedFreq((harmonics_count + 1) * kFundamental);
+    const float kCenter(kExpectedFreq / kBinWidth);
+    if (kCenter + 0.5f >= spectrum_length - 1) {
+      break;
+    }
+    const unsigned int kBegin(static_cast<unsigned int>(
+      std::max(1.0f, std::floor(kCenter - kHalfWidth + 0.5f))));
+    const unsigned int kEnd(std::min(spectrum_length - 2,
+      static_cast<unsigned int>(std::floor(kCenter + kHalfWidth + 0.5f))));
+    float* const peak_data(&output[1 + harmonics_count * HarmonicPeak::kCount]);
+    peak_data[HarmonicPeak::kFrequency] = kExpectedFreq;
+    peak_data[HarmonicPeak::kAmplitude] = 0.0f;
+    if (kEnd >= kBegin) {
+      std::ptrdiff_t offset(0);
+      const float kMax(Eigen::Map<const Eigen::ArrayXf>(&peaks_power[kBegin],
+                                                        kEnd - kBegin + 1)
+                         .maxCoeff(&offset));
+      if (kMax > 0.0f) {
+        const unsigned int kIdx(kBegin + static_cast<unsigned int>(offset));
+        const float kPrevPower(spectrogram_power[kIdx - 1]);
+        const float kNextPower(spectrogram_power[kIdx + 1]);
+        const float kDenominator(kPrevPower - 2.0f * kMax + kNextPower);
+        const float kShift((kDenominator != 0.0f)
+                           ? ParabolicArgMin(kPrevPower, kMax, kNextPower)
+                           : 0.0f);
+        const float kPower(kMax - 0.25f * (kPrevPower - kNextPower) * kShift);
+        peak_data[HarmonicPeak::kFrequency] = (kIdx + kShift) * kBinWidth;
+        peak_data[HarmonicPeak::kAmplitude] = std::sqrt(std::max(kPower, kMax));
+      }
+    }
+    harmonics_count += 1;
+  }
+  output[0] = static_cast<float>(harmonics_count);
+  // Unused harmonics
+  std::fill(&output[1 + harmonics_count * HarmonicPeak::kCount],
+            &output[1 + kMaxHarmonicsCount * HarmonicPeak::kCount],
+            0.0f);
+}
+
+descriptors::Descriptor_Meta HarmonicPeaks::Meta(void) const {
+  const float kMaxFreq(manager_->AnalysisParameters().sampling_freq / 2.0f);
+  // Amplitude is at most the frame length
+  const float kMaxAmplitude(
+    static_cast<float>(manager_->AnalysisParameters().dft_length));
+  return descriptors::Descriptor_Meta(
+    1 + kMaxHarmonicsCount * HarmonicPeak::kCount,
+    0.0f,
+    std::max(std::max(kMaxFreq, kMaxAmplitude),
+             static_cast<float>(kMaxHarmonicsCount)));
+}
+
+bool HarmonicPeaks::IsGated(void) const {
+  return true;
+}
+
+void HarmonicPeaks::Silence(float* const output) {
+  std::fill(&output[0],
+            &output[1 + kMaxHarmonicsCount * HarmonicPeak::kCount],
+            0.0f);
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
@@ -0,0 +1,101 @@
+/// @file harmonicpeaks.h
+/// @brief Harmonic peaks extraction declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_HARMONICPEAKS_H_
+#define CHARTREUSE_SRC_ALGORITHMS_HARMONICPEAKS_H_
+
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Harmonic peak layout
+// Using the namespace trick...
+namespace HarmonicPeak {
+enum Type {
+  kFrequency = 0,
+  kAmplitude,
+  kCount
+};
+}
+
+/// @brief Maximum number of extracted harmonics
+static const unsigned int kMaxHarmonicsCount(64);
+
+/// @brief Harmonic search window half width, relatively to the fundamental
+static const float kHarmonicTolerance(0.15f);
+
+/// @brief Retrieve the number of harmonics in the given peaks list
+unsigned int HarmonicsCount(const float* const harmonic_peaks);
+
+/// @brief Retrieve the given harmonic peak (0 being the fundamental)
+/// in the given peaks list
+const float* HarmonicPeakData(const float* const harmonic_peaks,
+                              const unsigned int harmonic);
+
+/// @brief Extract the spectrum peaks at each multiple of the fundamental
+/// frequency.
+///
+/// Local maxima of the whole spectrum are detected at once, the highest one
+/// within each harmonic search window is then refined by parabolic
+/// approximation.
+/// Output is a compact peaks list: the harmonics count, followed by one
+/// (frequency, amplitude) pair for each harmonic as given by
+/// HarmonicPeak::Type.
+/// A harmonic without any peak within its window has a null amplitude,
+/// at its theoretical frequency.
+class HarmonicPeaks : public descriptors::Descriptor_Interface {
+ public:
+  explicit HarmonicPeaks(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  ///
+  /// @param[in]  spectrogram_power   Power spectrum
+  /// @param[in]  spectrum_length   Power spectrum length
+  /// @param[in]  estimated_lag   Fundamental frequency lag, in samples
+  /// @param[in]  sampling_freq   Analysis sampling frequency
+  /// @param[out]  output   Harmonic peaks list
+  void Process(const float* const spectrogram_power,
+               const unsigned int spectrum_length,
+               const float estimated_lag,
+               const float sampling_freq,
+               float* const output);
+
+  descriptors::Descriptor_Meta Meta(void) const;
+
+  /// @brief Skipped on silent frames, the fundamental being unknown
+  bool IsGated(void) const;
+
+  /// @brief Silent frames have no harmonic at all
+  void Silence(float* const output);
+
+ private:
+  // No assignment operator for this class
+  HarmonicPeaks& operator=(const HarmonicPeaks& right);
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_HARMONICPEAKS_H_
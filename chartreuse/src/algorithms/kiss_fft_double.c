@@ -0,0 +1,37 @@
+/// @file kiss_fft_double.c
+/// @brief Double precision KissFFT build
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// The whole kiss_fft library is compiled a second time here,
+// with double samples and all its external symbols renamed:
+// see kiss_fft_double.h for the exposed declarations.
+#define kiss_fft_scalar double
+#define kiss_fft_cpx kiss_fft_double_cpx
+#define kiss_fft_state kiss_fft_double_state
+#define kiss_fft_cfg kiss_fft_double_cfg
+#define kiss_fft_alloc kiss_fft_double_alloc
+#define kiss_fft kiss_fft_double
+#define kiss_fft_stride kiss_fft_double_stride
+#define kiss_fft_cleanup kiss_fft_double_cleanup
+#define kiss_fft_next_fast_size kiss_fft_double_next_fast_size
+#define kf_work kiss_fft_double_work
+#define kf_factor kiss_fft_double_factor
+
+#include "kiss_fft.c"
@@ -0,0 +1,59 @@
+/// @file kiss_fft_double.h
+/// @brief Double precision KissFFT declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_KISS_FFT_DOUBLE_H_
+#define CHARTREUSE_SRC_ALGORITHMS_KISS_FFT_DOUBLE_H_
+
+// size_t
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// @brief Subset of the kiss_fft API, built with a double kiss_fft_scalar
+///
+/// All symbols are prefixed with kiss_fft_double so that both the float
+/// and the double versions of the library may be linked together
+/// (see kiss_fft_double.c).
+typedef struct {
+  double r;
+  double i;
+} kiss_fft_double_cpx;
+
+typedef struct kiss_fft_double_state* kiss_fft_double_cfg;
+
+kiss_fft_double_cfg kiss_fft_double_alloc(int nfft,
+                                          int inverse_fft,
+                                          void* mem,
+                                          size_t* lenmem);
+
+void kiss_fft_double(kiss_fft_double_cfg cfg,
+                     const kiss_fft_double_cpx* fin,
+                     kiss_fft_double_cpx* fout);
+
+void kiss_fft_double_cleanup(void);
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_KISS_FFT_DOUBLE_H_
@@ -20,28 +20,148 @@
 
 #include "chartreuse/src/algorithms/kissfft.h"
 
+// std::copy_n, std::fill
 #include <algorithm>
+// std::cos, std::sin
+#include <cmath>
 
 #include "chartreuse/src/algorithms/algorithms_common.h"
+#include "chartreuse/src/algorithms/workspace.h"
 #include "chartreuse/src/common.h"
+#include "chartreuse/src/interface/analysiscontext.h"
 #include "chartreuse/src/interface/manager.h"
 
 namespace chartreuse {
 namespace algorithms {
 
+template <typename SampleType>
+BasicKissFFTPlan<SampleType>::BasicKissFFTPlan(const unsigned int dft_length)
+    : dft_length_(dft_length),
+      config_(nullptr),
+      super_twiddles_(dft_length / 4) {
+  CHARTREUSE_ASSERT(dft_length > 1);
+  CHARTREUSE_ASSERT(IsPowerOfTwo(dft_length));
+  // The real transform is done by a half-length complex one,
+  // followed by a split step (see kiss_fftr)
+  const unsigned int kHalfLength(dft_length / 2);
+  config_ = KissFFTTraits<SampleType>::Alloc(kHalfLength);
+  CHARTREUSE_ASSERT(config_ != NULL);
+  for (unsigned int i(0); i < super_twiddles_.size(); ++i) {
+    const double kPhase(-3.14159265358979323846264338327
+                        * (static_cast<double>(i + 1) / kHalfLength + 0.5));
+    super_twiddles_[i].r = static_cast<SampleType>(std::cos(kPhase));
+    super_twiddles_[i].i = static_cast<SampleType>(std::sin(kPhase));
+  }
+}
+
+template <typename SampleType>
+BasicKissFFTPlan<SampleType>::~BasicKissFFTPlan() {
+  ::free(config_);
+  KissFFTTraits<SampleType>::Cleanup();
+}
+
+template <typename SampleType>
+void BasicKissFFTPlan<SampleType>::Process(const SampleType* const input,
+                          Complex* const scratch,
+                          SampleType* const output) const {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(scratch != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(input != output);
+
+  // Parallel transform of the even and odd samples packed in (real, imag)
+  KissFFTTraits<SampleType>::Transform(
+    config_,
+    reinterpret_cast<const Complex*>(input),
+    scratch);
+
+  Complex* const freqdata(reinterpret_cast<Complex*>(output));
+  const unsigned int kHalfLength(dft_length_ / 2);
+  const SampleType kHalf(static_cast<SampleType>(0.5));
+  // DC and Nyquist bins are in the DC element of the packed transform
+  freqdata[0].r = scratch[0].r + scratch[0].i;
+  freqdata[0].i = static_cast<SampleType>(0.0);
+  freqdata[kHalfLength].r = scratch[0].r - scratch[0].i;
+  freqdata[kHalfLength].i = static_cast<SampleType>(0.0);
+  for (unsigned int k(1); k <= kHalfLength / 2; ++k) {
+    const Complex kFpk(scratch[k]);
+    const Complex kFpnk = {scratch[kHalfLength - k].r,
+                                -scratch[kHalfLength - k].i};
+    const Complex kF1k = {kFpk.r + kFpnk.r, kFpk.i + kFpnk.i};
+    const Complex kF2k = {kFpk.r - kFpnk.r, kFpk.i - kFpnk.i};
+    const Complex& kTwiddle(super_twiddles_[k - 1]);
+    const Complex kTw = {kF2k.r * kTwiddle.r - kF2k.i * kTwiddle.i,
+                              kF2k.r * kTwiddle.i + kF2k.i * kTwiddle.r};
+    freqdata[k].r = kHalf * (kF1k.r + kTw.r);
+    freqdata[k].i = kHalf * (kF1k.i + kTw.i);
+    freqdata[kHalfLength - k].r = kHalf * (kF1k.r - kTw.r);
+    freqdata[kHalfLength - k].i = kHalf * (kTw.i - kF1k.i);
+  }
+}
+
+template <typename SampleType>
+void BasicKissFFTPlan<SampleType>::ProcessInverse(const SampleType* const input,
+                                 Complex* const scratch,
+                                 SampleType* const output) const {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(scratch != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(input != output);
+
+  const Complex* const freqdata(
+    reinterpret_cast<const Complex*>(input));
+  const unsigned int kHalfLength(dft_length_ / 2);
+  // Merge back the DC and Nyquist bins (see kiss_fftri)
+  scratch[0].r = freqdata[0].r + freqdata[kHalfLength].r;
+  scratch[0].i = freqdata[0].r - freqdata[kHalfLength].r;
+  for (unsigned int k(1); k <= kHalfLength / 2; ++k) {
+    const Complex kFk(freqdata[k]);
+    const Complex kFnkc = {freqdata[kHalfLength - k].r,
+                                -freqdata[kHalfLength - k].i};
+    const Complex kFek = {kFk.r + kFnkc.r, kFk.i + kFnkc.i};
+    const Complex kTmp = {kFk.r - kFnkc.r, kFk.i - kFnkc.i};
+    // Inverse twiddles are the conjugate of the forward ones
+    const Complex& kTwiddle(super_twiddles_[k - 1]);
+    const Complex kFok = {kTmp.r * kTwiddle.r + kTmp.i * kTwiddle.i,
+                               kTmp.i * kTwiddle.r - kTmp.r * kTwiddle.i};
+    scratch[k].r = kFek.r + kFok.r;
+    scratch[k].i = kFek.i + kFok.i;
+    scratch[kHalfLength - k].r = kFek.r - kFok.r;
+    scratch[kHalfLength - k].i = kFok.i - kFek.i;
+  }
+  // The plan only holds the forward complex transform:
+  // the inverse one is retrieved by conjugating both its input and output
+  for (unsigned int k(0); k < kHalfLength; ++k) {
+    scratch[k].i = -scratch[k].i;
+  }
+  Complex* const timedata(reinterpret_cast<Complex*>(output));
+  KissFFTTraits<SampleType>::Transform(config_, scratch, timedata);
+  for (unsigned int k(0); k < kHalfLength; ++k) {
+    timedata[k].i = -timedata[k].i;
+  }
+}
+
+template <typename SampleType>
+unsigned int BasicKissFFTPlan<SampleType>::Length(void) const {
+  return dft_length_;
+}
+
+template <typename SampleType>
+unsigned int BasicKissFFTPlan<SampleType>::ScratchLength(void) const {
+  return dft_length_ / 2;
+}
+
+template class BasicKissFFTPlan<float>;
+template class BasicKissFFTPlan<double>;
+
 KissFFT::KissFFT(interface::Manager* manager)
     : Descriptor_Interface(manager),
-      config_(kiss_fftr_alloc(manager_->AnalysisParameters().dft_length,
-                              0,
-                              NULL,
-                              NULL)),
-      zeropad_(manager_->AnalysisParameters().dft_length + 2, 0.0f) {
+      plan_(manager_->Context().DftPlan()) {
   // Nothing to do here for now
 }
 
 KissFFT::~KissFFT() {
-  ::free(config_);
-  kiss_fft_cleanup();
+  // Nothing to do here for now
 }
 
 void KissFFT::operator()(float* const output) {
@@ -65,13 +185,16 @@ void KissFFT::Process(const float* const input,
   const unsigned int kActualInputLength(
     // Cast for 64b systems
     std::min(static_cast<unsigned int>(input_length), dft_length));
+  CHARTREUSE_ASSERT(dft_length == plan_.Length());
+  Workspace::Scope scope(&manager_->Scratch());
+  float* const zeropad(scope.Floats(dft_length + 2));
+  kiss_fft_cpx* const scratch(
+    scope.Borrow<kiss_fft_cpx>(plan_.ScratchLength()));
   std::copy_n(&input[0],
               kActualInputLength,
-              &zeropad_[0]);
-  return kiss_fftr(config_,
-                   &zeropad_[0],
-                   // TODO(gm): something cleaner?
-                   reinterpret_cast<kiss_fft_cpx*>(output));
+              &zeropad[0]);
+  std::fill(&zeropad[kActualInputLength], &zeropad[dft_length + 2], 0.0f);
+  plan_.Process(&zeropad[0], &scratch[0], output);
 }
 
 descriptors::Descriptor_Meta KissFFT::Meta(void) const {
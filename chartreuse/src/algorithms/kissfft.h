@@ -23,14 +23,119 @@
 
 #include <vector>
 
-#include "externals/kiss_fft/tools/kiss_fftr.h"
+#include "externals/kiss_fft/kiss_fft.h"
 
+#include "chartreuse/src/algorithms/kiss_fft_double.h"
 #include "chartreuse/src/descriptors/descriptor_interface.h"
 
 namespace chartreuse {
 namespace algorithms {
 
+/// @brief Kiss FFT types and functions for a given sample type
+///
+/// Only specialized for float and double: the latter uses a second build
+/// of the library (see kiss_fft_double.h).
+template <typename SampleType>
+struct KissFFTTraits;
+
+template <>
+struct KissFFTTraits<float> {
+  typedef kiss_fft_cpx Complex;
+  typedef kiss_fft_cfg Config;
+
+  static Config Alloc(const int nfft) {
+    return kiss_fft_alloc(nfft, 0, NULL, NULL);
+  }
+  static void Transform(const Config config,
+                        const Complex* const input,
+                        Complex* const output) {
+    kiss_fft(config, input, output);
+  }
+  static void Cleanup(void) {
+    kiss_fft_cleanup();
+  }
+};
+
+template <>
+struct KissFFTTraits<double> {
+  typedef kiss_fft_double_cpx Complex;
+  typedef kiss_fft_double_cfg Config;
+
+  static Config Alloc(const int nfft) {
+    return kiss_fft_double_alloc(nfft, 0, NULL, NULL);
+  }
+  static void Transform(const Config config,
+                        const Complex* const input,
+                        Complex* const output) {
+    kiss_fft_double(config, input, output);
+  }
+  static void Cleanup(void) {
+    kiss_fft_double_cleanup();
+  }
+};
+
+/// @brief Kiss FFT real transform plan: holds all twiddle factors.
+///
+/// The plan itself is never written to when processing, all scratch memory
+/// being given by the caller: hence it may be shared between many instances,
+/// even running concurrently.
+///
+/// Templated on the sample type, explicitly instantiated for float and double.
+template <typename SampleType>
+class BasicKissFFTPlan {
+ public:
+  typedef typename KissFFTTraits<SampleType>::Complex Complex;
+
+  /// @brief Default constructor, synthesizes all twiddle factors
+  ///
+  /// @param[in]  dft_length   Real transform length, has to be a power of 2
+  explicit BasicKissFFTPlan(const unsigned int dft_length);
+  ~BasicKissFFTPlan();
+
+  /// @brief Real forward transform of exactly dft_length input samples
+  ///
+  /// @param[in]  input   Input data, of dft_length
+  /// @param[in]  scratch   Scratch memory, of ScratchLength()
+  /// @param[out]  output   Interleaved complex output, of (dft_length + 2)
+  void Process(const SampleType* const input,
+               Complex* const scratch,
+               SampleType* const output) const;
+
+  /// @brief Real inverse transform, back to exactly dft_length samples
+  ///
+  /// As for most FFT libraries the output is not normalized,
+  /// e.g. it is scaled by dft_length.
+  ///
+  /// @param[in]  input   Interleaved complex input, of (dft_length + 2)
+  /// @param[in]  scratch   Scratch memory, of ScratchLength()
+  /// @param[out]  output   Real output, of dft_length
+  void ProcessInverse(const SampleType* const input,
+                      Complex* const scratch,
+                      SampleType* const output) const;
+
+  /// @brief Transform length
+  unsigned int Length(void) const;
+
+  /// @brief Required scratch memory length, in complex elements
+  unsigned int ScratchLength(void) const;
+
+ private:
+  // No assignment operator for this class
+  BasicKissFFTPlan& operator=(const BasicKissFFTPlan& right);
+  // No copy constructor for this class
+  BasicKissFFTPlan(const BasicKissFFTPlan& right);
+
+  const unsigned int dft_length_;  ///< Real transform length
+  /// Half-length complex transform plan
+  typename KissFFTTraits<SampleType>::Config config_;
+  std::vector<Complex> super_twiddles_;  ///< Real split twiddles
+};
+
+typedef BasicKissFFTPlan<float> KissFFTPlan;
+
 /// @brief Kiss FFT algorithm wrapper class
+///
+/// Uses the manager shared transform plan, only holding scratch memory.
 class KissFFT : public descriptors::Descriptor_Interface {
  public:
   explicit KissFFT(interface::Manager* manager);
@@ -53,8 +158,7 @@ class KissFFT : public descriptors::Descriptor_Interface {
   // No copy constructor for this class
   KissFFT(const KissFFT& right);
 
-  kiss_fftr_cfg config_;   ///< Internal KissFFT-specific persistent data
-  std::vector<float> zeropad_;   ///< Temporary buffer for zero-padding
+  const KissFFTPlan& plan_;   ///< Shared transform plan
 };
 
 }  // namespace algorithms
@@ -0,0 +1,133 @@
+/// @file normalizeddifference.cc
+/// @brief Cumulative mean normalized difference function implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/normalizeddifference.h"
+
+// std::copy_n, std::fill
+#include <algorithm>
+
+#include "chartreuse/src/algorithms/kissfft.h"
+#include "chartreuse/src/algorithms/workspace.h"
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/interface/analysiscontext.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+NormalizedDifference::NormalizedDifference(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      plan_(manager_->Context().DftPlan()) {
+  // Nothing to do here for now
+}
+
+void NormalizedDifference::operator()(float* const output) {
+  Process(manager_->CurrentWindow(),
+          manager_->AnalysisParameters().window_length,
+          manager_->AnalysisParameters().min_lag,
+          manager_->AnalysisParameters().max_lag,
+          output);
+}
+
+void NormalizedDifference::Process(const float* const input,
+                                   const std::size_t input_length,
+                                   const unsigned int min_lag,
+                                   const unsigned int max_lag,
+                                   float* const output) {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(input_length > 0);
+  CHARTREUSE_ASSERT(min_lag > 0);
+  CHARTREUSE_ASSERT(max_lag > 0);
+  CHARTREUSE_ASSERT(max_lag > min_lag);
+  CHARTREUSE_ASSERT(input_length > max_lag);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(input != output);
+
+  const unsigned int kDftLength(plan_.Length());
+  // Cast for 64b systems
+  const unsigned int kInputLength(static_cast<unsigned int>(input_length));
+  // No circular aliasing as long as the whole input fits into the transform
+  CHARTREUSE_ASSERT(kInputLength <= kDftLength);
+  const unsigned int kWindowLength(kInputLength - max_lag);
+  const unsigned int kSpectrumLength(kDftLength / 2 + 1);
+
+  Workspace::Scope scope(&manager_->Scratch());
+  float* const zeropad(scope.Floats(kDftLength));
+  float* const window_dft(scope.Floats(kDftLength + 2));
+  float* const input_dft(scope.Floats(kDftLength + 2));
+  kiss_fft_cpx* const scratch(
+    scope.Borrow<kiss_fft_cpx>(plan_.ScratchLength()));
+
+  // Cross-correlation between the integration window and the whole input:
+  // r(lag) = IFFT(conj(FFT(window)) . FFT(input))
+  std::copy_n(&input[0], kInputLength, &zeropad[0]);
+  std::fill(&zeropad[kInputLength], &zeropad[kDftLength], 0.0f);
+  plan_.Process(&zeropad[0], &scratch[0], &input_dft[0]);
+  std::fill(&zeropad[kWindowLength], &zeropad[kInputLength], 0.0f);
+  plan_.Process(&zeropad[0], &scratch[0], &window_dft[0]);
+  for (unsigned int k(0); k < kSpectrumLength; ++k) {
+    const float kRe(window_dft[2 * k]);
+    const float kIm(window_dft[2 * k + 1]);
+    const float kInRe(input_dft[2 * k]);
+    const float kInIm(input_dft[2 * k + 1]);
+    window_dft[2 * k] = kRe * kInRe + kIm * kInIm;
+    window_dft[2 * k + 1] = kRe * kInIm - kIm * kInRe;
+  }
+  float* const correlation(zeropad);
+  plan_.ProcessInverse(&window_dft[0], &scratch[0], &correlation[0]);
+  const double kNormalization(1.0 / kDftLength);
+
+  // Sliding energies, accumulated in double precision since differences
+  // of nearly equal quantities are to be computed
+  double energy_origin(0.0);
+  for (unsigned int i(0); i < kWindowLength; ++i) {
+    energy_origin += static_cast<double>(input[i]) * input[i];
+  }
+  double energy_lag(energy_origin);
+  double difference_sum(0.0);
+  for (unsigned int lag(1); lag < max_lag; ++lag) {
+    const double kOut(input[lag - 1]);
+    const double kIn(input[lag - 1 + kWindowLength]);
+    energy_lag += kIn * kIn - kOut * kOut;
+    const double kDifference(std::max(
+      0.0,
+      energy_origin + energy_lag
+        - 2.0 * kNormalization * correlation[lag]));
+    difference_sum += kDifference;
+    if (lag >= min_lag) {
+      // Convention for a null signal: no dip at all
+      output[lag - min_lag] = (difference_sum > 0.0)
+        ? static_cast<float>(kDifference * lag / difference_sum)
+        : 1.0f;
+    }
+  }
+}
+
+descriptors::Descriptor_Meta NormalizedDifference::Meta(void) const {
+  return descriptors::Descriptor_Meta(
+    manager_->AnalysisParameters().max_lag
+      - manager_->AnalysisParameters().min_lag,
+    0.0f,
+    // d(lag) being at most the sum of all differences up to lag
+    static_cast<float>(manager_->AnalysisParameters().max_lag));
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
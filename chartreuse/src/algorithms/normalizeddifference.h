@@ -0,0 +1,78 @@
+/// @file normalizeddifference.h
+/// @brief Cumulative mean normalized difference function declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_NORMALIZEDDIFFERENCE_H_
+#define CHARTREUSE_SRC_ALGORITHMS_NORMALIZEDDIFFERENCE_H_
+
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+// Internal forward declaration
+template <typename SampleType> class BasicKissFFTPlan;
+typedef BasicKissFFTPlan<float> KissFFTPlan;
+
+/// @brief Cumulative mean normalized difference function (CMNDF),
+/// as defined by the YIN pitch estimator
+///
+/// The difference function is expanded as
+/// d(lag) = e(0) + e(lag) - 2 r(lag), with e the sliding window energy
+/// and r the cross-correlation, the latter being computed by FFT:
+/// the cost does not depend on the number of lags anymore.
+class NormalizedDifference : public descriptors::Descriptor_Interface {
+ public:
+  explicit NormalizedDifference(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  ///
+  /// The integration window is the first (input_length - max_lag) samples,
+  /// output is given for lags within [min_lag ; max_lag[
+  ///
+  /// @param[in]  input   Input signal, of input_length
+  /// @param[in]  input_length   Input length, at most the plan length
+  /// @param[in]  min_lag   Smaller lag to output
+  /// @param[in]  max_lag   Higher lag (excluded)
+  /// @param[out]  output   CMNDF, of (max_lag - min_lag)
+  void Process(const float* const input,
+               const std::size_t input_length,
+               const unsigned int min_lag,
+               const unsigned int max_lag,
+               float* const output);
+
+  descriptors::Descriptor_Meta Meta(void) const;
+
+ private:
+  // No assignment operator for this class
+  NormalizedDifference& operator=(const NormalizedDifference& right);
+  // No copy constructor for this class
+  NormalizedDifference(const NormalizedDifference& right);
+
+  const KissFFTPlan& plan_;   ///< Shared transform plan
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_NORMALIZEDDIFFERENCE_H_
@@ -0,0 +1,99 @@
+/// @file octavebands.cc
+/// @brief Logarithmic frequency bands summation implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/octavebands.h"
+
+// std::min
+#include <algorithm>
+// std::ceil, std::floor, std::frexp, std::pow
+#include <cmath>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/algorithms/algorithms_common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Check if the given value is an exact (positive or negative)
+/// power of 2
+static bool IsPowerOfTwoRatio(const float value) {
+  int exponent(0);
+  return std::frexp(value, &exponent) == 0.5f;
+}
+
+OctaveBands::OctaveBands(const float resolution,
+                         const float low_freq,
+                         const float high_freq,
+                         const unsigned int dft_length,
+                         const float sampling_freq)
+    : edges_() {
+  CHARTREUSE_ASSERT(resolution >= 1.0f / 16.0f);
+  CHARTREUSE_ASSERT(resolution <= 8.0f);
+  // Resolution is a power of 2
+  CHARTREUSE_ASSERT(IsPowerOfTwoRatio(resolution));
+  CHARTREUSE_ASSERT(low_freq > 0.0f);
+  CHARTREUSE_ASSERT(high_freq > low_freq);
+  CHARTREUSE_ASSERT(dft_length > 0);
+  CHARTREUSE_ASSERT(sampling_freq > 0.0f);
+  CHARTREUSE_ASSERT(low_freq < sampling_freq / 2.0f);
+
+  const unsigned int kSpectrumLength(dft_length / 2 + 1);
+  const float kBinWidth(sampling_freq / dft_length);
+  const float kHighFreq(std::min(high_freq, sampling_freq / 2.0f));
+  const unsigned int kLogBandsCount(static_cast<unsigned int>(
+    std::floor(LogTwo(kHighFreq / low_freq) / resolution + 1e-4f)));
+
+  // Lower band: from DC to the low edge
+  edges_.push_back(0);
+  for (unsigned int band(0); band <= kLogBandsCount; ++band) {
+    const float kEdgeFreq(low_freq * std::pow(2.0f, band * resolution));
+    const unsigned int kEdge(static_cast<unsigned int>(
+      std::ceil(kEdgeFreq / kBinWidth)));
+    edges_.push_back(std::min(kEdge, kSpectrumLength));
+  }
+  // Higher band: from the high edge to Nyquist
+  edges_.push_back(kSpectrumLength);
+}
+
+void OctaveBands::Sum(const float* const spectrum_power,
+                      float* const output) const {
+  CHARTREUSE_ASSERT(spectrum_power != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrum_power != output);
+
+  for (unsigned int band(0); band < BandsCount(); ++band) {
+    output[band] = Eigen::Map<const Eigen::ArrayXf>(
+      &spectrum_power[edges_[band]],
+      edges_[band + 1] - edges_[band]).sum();
+  }
+}
+
+unsigned int OctaveBands::BandsCount(void) const {
+  return static_cast<unsigned int>(edges_.size()) - 1;
+}
+
+const unsigned int* OctaveBands::Edges(void) const {
+  return &edges_[0];
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
@@ -0,0 +1,76 @@
+/// @file octavebands.h
+/// @brief Logarithmic frequency bands summation declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_OCTAVEBANDS_H_
+#define CHARTREUSE_SRC_ALGORITHMS_OCTAVEBANDS_H_
+
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Logarithmic frequency bands, as defined by MPEG-7:
+/// bands of the given octave resolution between a low and a high edge,
+/// plus one band gathering all lower frequencies and another gathering
+/// all higher frequencies.
+///
+/// Each spectrum bin belongs to exactly one band, the one containing its
+/// frequency: bands are contiguous bins segments, stored as a table of edges
+/// indexes precomputed once.
+/// Note that at fine resolutions the lower bands may be narrower than a bin,
+/// in which case they are empty.
+class OctaveBands {
+ public:
+  /// @brief Default constructor, computes the band edges table
+  ///
+  /// @param[in]  resolution   Bands width, in octaves
+  /// (a power of 2 within [1/16 ; 8])
+  /// @param[in]  low_freq   Lower edge of the first logarithmic band
+  /// @param[in]  high_freq   Maximum higher edge of the last logarithmic band,
+  /// actually the closest lower one respecting the resolution and Nyquist
+  /// @param[in]  dft_length   Length of the Dft the spectrum comes from
+  /// @param[in]  sampling_freq   Analysis sampling frequency
+  explicit OctaveBands(const float resolution,
+                       const float low_freq,
+                       const float high_freq,
+                       const unsigned int dft_length,
+                       const float sampling_freq);
+
+  /// @brief Sum the given power spectrum within each band
+  ///
+  /// @param[in]  spectrum_power   Power spectrum, of (dft_length / 2 + 1)
+  /// @param[out]  output   Bands power, of BandsCount()
+  void Sum(const float* const spectrum_power, float* const output) const;
+
+  /// @brief Number of bands, including the lower and higher ones
+  unsigned int BandsCount(void) const;
+
+  /// @brief Retrieve the edges table, of BandsCount() + 1:
+  /// band i spans bins within [Edges()[i] ; Edges()[i + 1][
+  const unsigned int* Edges(void) const;
+
+ private:
+  std::vector<unsigned int> edges_;  ///< First bin of each band, plus end
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_OCTAVEBANDS_H_
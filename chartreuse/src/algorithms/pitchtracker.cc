@@ -0,0 +1,176 @@
+/// @file pitchtracker.cc
+/// @brief Streaming pitch tracker implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/pitchtracker.h"
+
+// std::min, std::min_element
+#include <algorithm>
+// std::abs
+#include <cmath>
+// std::numeric_limits
+#include <limits>
+
+#include "chartreuse/src/algorithms/algorithms_common.h"
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+PitchTracker::PitchTracker()
+    : columns_(),
+      hops_count_(0) {
+  // Nothing to do here for now
+}
+
+float PitchTracker::Process(const float* const normalized_difference,
+                            const unsigned int min_lag,
+                            const unsigned int max_lag) {
+  CHARTREUSE_ASSERT(normalized_difference != nullptr);
+  CHARTREUSE_ASSERT(min_lag > 0);
+  CHARTREUSE_ASSERT(max_lag > min_lag);
+
+  const std::size_t kHistoryLength(columns_.size());
+  const std::size_t kCurrent(hops_count_ % kHistoryLength);
+  Column& current(columns_[kCurrent]);
+  ExtractCandidates(normalized_difference, min_lag, max_lag, &current);
+
+  // Viterbi step: best path towards each candidate
+  if (hops_count_ > 0) {
+    const Column& previous(
+      columns_[(kCurrent + kHistoryLength - 1) % kHistoryLength]);
+    for (unsigned int candidate(0); candidate < current.count; ++candidate) {
+      float best_cost(std::numeric_limits<float>::max());
+      unsigned int best_previous(0);
+      for (unsigned int prev(0); prev < previous.count; ++prev) {
+        const float kCost(previous.cost[prev]
+                          + kPitchTransitionWeight
+                            * std::abs(current.log_period[candidate]
+                                       - previous.log_period[prev]));
+        if (kCost < best_cost) {
+          best_cost = kCost;
+          best_previous = prev;
+        }
+      }
+      current.cost[candidate] += best_cost;
+      current.backpointer[candidate] = best_previous;
+    }
+  }
+  // Path costs are only relative: keeping them bounded
+  unsigned int best(0);
+  for (unsigned int candidate(1); candidate < current.count; ++candidate) {
+    if (current.cost[candidate] < current.cost[best]) {
+      best = candidate;
+    }
+  }
+  const float kBestCost(current.cost[best]);
+  for (unsigned int candidate(0); candidate < current.count; ++candidate) {
+    current.cost[candidate] -= kBestCost;
+  }
+  hops_count_ += 1;
+
+  // Trace back the best path to the output hop
+  const std::size_t kSteps(
+    std::min(static_cast<std::size_t>(kPitchTrackLatency), hops_count_ - 1));
+  std::size_t column_idx(kCurrent);
+  for (std::size_t step(0); step < kSteps; ++step) {
+    best = columns_[column_idx].backpointer[best];
+    column_idx = (column_idx + kHistoryLength - 1) % kHistoryLength;
+  }
+  return columns_[column_idx].period[best];
+}
+
+void PitchTracker::Reset(void) {
+  hops_count_ = 0;
+}
+
+void PitchTracker::CopyState(const PitchTracker& other) {
+  columns_ = other.columns_;
+  hops_count_ = other.hops_count_;
+}
+
+void PitchTracker::ExtractCandidates(const float* const normalized_difference,
+                                     const unsigned int min_lag,
+                                     const unsigned int max_lag,
+                                     Column* const column) {
+  const float* const data(normalized_difference);
+  const unsigned int kDataLength(max_lag - min_lag);
+  // Most likely period: the first dip below the threshold,
+  // the global minimum if there is none
+  unsigned int first_dip(0);
+  while ((first_dip < kDataLength) && (data[first_dip] >= kPitchDipThreshold)) {
+    first_dip += 1;
+  }
+  if (first_dip < kDataLength) {
+    while ((first_dip + 1 < kDataLength)
+           && (data[first_dip + 1] < data[first_dip])) {
+      first_dip += 1;
+    }
+  } else {
+    first_dip = static_cast<unsigned int>(
+      std::min_element(&data[0], &data[kDataLength]) - &data[0]);
+  }
+
+  // Always kept, other local minima sorted by increasing value
+  std::array<unsigned int, kPitchCandidatesCount> dips;
+  dips[0] = first_dip;
+  unsigned int count(1);
+  for (unsigned int i(1); i + 1 < kDataLength; ++i) {
+    const float kDip(data[i]);
+    if ((i == first_dip) || (kDip >= data[i - 1]) || (kDip > data[i + 1])) {
+      continue;
+    }
+    if ((count == kPitchCandidatesCount) && (kDip >= data[dips[count - 1]])) {
+      continue;
+    }
+    unsigned int position(std::min(count, kPitchCandidatesCount - 1));
+    while ((position > 1) && (data[dips[position - 1]] > kDip)) {
+      dips[position] = dips[position - 1];
+      position -= 1;
+    }
+    dips[position] = i;
+    count = std::min(count + 1, kPitchCandidatesCount);
+  }
+
+  for (unsigned int candidate(0); candidate < count; ++candidate) {
+    const unsigned int kIndex(dips[candidate]);
+    float offset(0.0f);
+    if ((kIndex > 0) && (kIndex + 1 < kDataLength)) {
+      const float kPrev(data[kIndex - 1]);
+      const float kDip(data[kIndex]);
+      const float kNext(data[kIndex + 1]);
+      const float kCurvature(kPrev - 2.0f * kDip + kNext);
+      if (kCurvature > 0.0f) {
+        offset = 0.5f * (kPrev - kNext) / kCurvature;
+      }
+    }
+    const float kPeriod(static_cast<float>(min_lag + kIndex) + offset);
+    column->period[candidate] = kPeriod;
+    column->log_period[candidate] = LogTwo(kPeriod);
+    column->cost[candidate] = data[kIndex];
+    if (kIndex > first_dip) {
+      column->cost[candidate] += kPitchSubharmonicPenalty;
+    }
+    column->backpointer[candidate] = 0;
+  }
+  column->count = count;
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
@@ -0,0 +1,101 @@
+/// @file pitchtracker.h
+/// @brief Streaming pitch tracker declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_PITCHTRACKER_H_
+#define CHARTREUSE_SRC_ALGORITHMS_PITCHTRACKER_H_
+
+// std::array
+#include <array>
+// std::size_t
+#include <cstddef>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Number of period candidates kept for each hop
+static const unsigned int kPitchCandidatesCount(4);
+/// @brief Pitch tracking latency, in hops
+static const unsigned int kPitchTrackLatency(8);
+/// @brief Transition cost for a one octave jump between two hops
+static const float kPitchTransitionWeight(1.0f);
+/// @brief Absolute threshold on the normalized difference:
+/// the first dip below it is the most likely period (as in YIN)
+static const float kPitchDipThreshold(0.1f);
+/// @brief Local cost added to candidates longer than the most likely period
+static const float kPitchSubharmonicPenalty(0.5f);
+
+/// @brief Streaming pitch tracker: fixed-lag Viterbi decoding
+/// over the best normalized difference (YIN CMNDF) dips of each hop
+///
+/// The local cost of a candidate is its normalized difference value.
+/// Period multiples being dips as deep as the period itself, candidates
+/// longer than the first dip below kPitchDipThreshold (the deepest dip
+/// if there is none) are penalized by kPitchSubharmonicPenalty.
+/// The transition cost is proportional to the pitch jump in octaves.
+/// Only the last kPitchTrackLatency hops are kept: decoding is done
+/// in O(kPitchCandidatesCount^2) each hop, the best path being then traced
+/// back to the hop being output - hence a bounded latency and
+/// a constant memory footprint.
+class PitchTracker {
+ public:
+  PitchTracker();
+
+  /// @brief Update the tracker with the next hop normalized difference
+  ///
+  /// @param[in]  normalized_difference   CMNDF of lags [min_lag ; max_lag[
+  /// @param[in]  min_lag   Smaller lag
+  /// @param[in]  max_lag   Higher lag (excluded)
+  ///
+  /// @return The smoothed period, in samples, kPitchTrackLatency hops ago
+  /// (or of the oldest hop if fewer were given since the last reset)
+  float Process(const float* const normalized_difference,
+                const unsigned int min_lag,
+                const unsigned int max_lag);
+
+  /// @brief Forget all previous hops
+  void Reset(void);
+
+  /// @brief Copy the given tracker state
+  void CopyState(const PitchTracker& other);
+
+ private:
+  /// @brief Candidates of one hop, along with their best path
+  struct Column {
+    std::array<float, kPitchCandidatesCount> period;
+    std::array<float, kPitchCandidatesCount> log_period;
+    std::array<float, kPitchCandidatesCount> cost;  ///< Best path cost
+    std::array<unsigned int, kPitchCandidatesCount> backpointer;
+    unsigned int count;
+  };
+
+  /// @brief Fill the given column with the best normalized difference dips
+  static void ExtractCandidates(const float* const normalized_difference,
+                                const unsigned int min_lag,
+                                const unsigned int max_lag,
+                                Column* const column);
+
+  std::array<Column, kPitchTrackLatency + 1> columns_;  ///< Circular history
+  std::size_t hops_count_;  ///< How many hops were given since the last reset
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_PITCHTRACKER_H_
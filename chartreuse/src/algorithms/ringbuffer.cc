@@ -18,7 +18,7 @@
 /// You should have received a copy of the GNU General Public License
 /// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
 
-// std::fill, std::copy, std::min, std::max
+// std::fill, std::copy, std::copy_n, std::min, std::max
 #include <algorithm>
 
 #include "chartreuse/src/algorithms/ringbuffer.h"
@@ -27,25 +27,29 @@
 namespace chartreuse {
 namespace algorithms {
 
-RingBuffer::RingBuffer(const std::size_t capacity)
+template <typename SampleType>
+BasicRingBuffer<SampleType>::BasicRingBuffer(const std::size_t capacity)
     : data_(nullptr),
       capacity_(capacity),
       size_(0),
       writing_position_(0),
       reading_position_(0) {
   CHARTREUSE_ASSERT(capacity > 0);
-  data_ = static_cast<float*>(new float[capacity_]);
-  std::fill_n(&data_[0], capacity_, 0.0f);
+  data_ = new SampleType[capacity_];
+  std::fill_n(&data_[0], capacity_, static_cast<SampleType>(0));
 }
 
-RingBuffer::~RingBuffer() {
+template <typename SampleType>
+BasicRingBuffer<SampleType>::~BasicRingBuffer() {
   delete[] data_;
   data_ = nullptr;
 }
 
-void RingBuffer::PopOverlapped(float* dest,
-                               const std::size_t count,
-                               const unsigned int overlap) {
+template <typename SampleType>
+void BasicRingBuffer<SampleType>::PopOverlapped(
+    SampleType* dest,
+    const std::size_t count,
+    const unsigned int overlap) {
   CHARTREUSE_ASSERT(IsGood());
   CHARTREUSE_ASSERT(overlap > 0);
 
@@ -77,14 +81,18 @@ void RingBuffer::PopOverlapped(float* dest,
   // Zero-padding
   std::fill_n(&dest[copy_count],
               zeropadding_count,
-              0.0f);
+              static_cast<SampleType>(0));
 }
 
-void RingBuffer::Pop(float* dest, const std::size_t count) {
+template <typename SampleType>
+void BasicRingBuffer<SampleType>::Pop(SampleType* dest,
+                                      const std::size_t count) {
   return PopOverlapped(dest, count, 1);
 }
 
-void RingBuffer::Push(const float* const src, const std::size_t count) {
+template <typename SampleType>
+void BasicRingBuffer<SampleType>::Push(const SampleType* const src,
+                                       const std::size_t count) {
   CHARTREUSE_ASSERT(IsGood());
   CHARTREUSE_ASSERT(count <= Capacity() - Size());
   // Length of the "right" part: from writing cursor to the buffer end
@@ -105,7 +113,9 @@ void RingBuffer::Push(const float* const src, const std::size_t count) {
   size_ += count;
 }
 
-void RingBuffer::Fill(const float value, const std::size_t count) {
+template <typename SampleType>
+void BasicRingBuffer<SampleType>::Fill(const SampleType value,
+                                       const std::size_t count) {
   CHARTREUSE_ASSERT(IsGood());
   CHARTREUSE_ASSERT(count > 0);
   CHARTREUSE_ASSERT(count <= Capacity() - Size());
@@ -127,28 +137,47 @@ void RingBuffer::Fill(const float value, const std::size_t count) {
   size_ += count;
 }
 
-void RingBuffer::Clear(void) {
+template <typename SampleType>
+void BasicRingBuffer<SampleType>::Clear(void) {
   writing_position_ = 0;
   reading_position_ = 0;
   size_ = 0;
   if (IsGood()) {
-    std::fill_n(&data_[0], Capacity(), 0.0f);
+    std::fill_n(&data_[0], Capacity(), static_cast<SampleType>(0));
   }
 }
 
-bool RingBuffer::IsGood(void) const {
+template <typename SampleType>
+void BasicRingBuffer<SampleType>::CopyState(const BasicRingBuffer& other) {
+  CHARTREUSE_ASSERT(IsGood());
+  CHARTREUSE_ASSERT(other.IsGood());
+  CHARTREUSE_ASSERT(Capacity() == other.Capacity());
+  std::copy_n(&other.data_[0], Capacity(), &data_[0]);
+  size_ = other.size_;
+  writing_position_ = other.writing_position_;
+  reading_position_ = other.reading_position_;
+}
+
+template <typename SampleType>
+bool BasicRingBuffer<SampleType>::IsGood(void) const {
   return data_ != nullptr;
 }
 
-std::size_t RingBuffer::Capacity(void) const {
+template <typename SampleType>
+std::size_t BasicRingBuffer<SampleType>::Capacity(void) const {
   CHARTREUSE_ASSERT(IsGood());
   return capacity_;
 }
 
-std::size_t RingBuffer::Size(void) const {
+template <typename SampleType>
+std::size_t BasicRingBuffer<SampleType>::Size(void) const {
   CHARTREUSE_ASSERT(IsGood());
   return size_;
 }
 
+// Explicit instantiations
+template class BasicRingBuffer<float>;
+template class BasicRingBuffer<double>;
+
 }  // namespace algorithms
 }  // namespace chartreuse
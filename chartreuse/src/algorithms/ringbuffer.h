@@ -31,11 +31,14 @@ namespace algorithms {
 /// Resizable, FIFO-type container; its general philosophy is that,
 /// if one operation could not be done (pushing too much data, etc.)
 /// it asserts - there are no return values nor exceptions.
-class RingBuffer {
+///
+/// Templated on the sample type, explicitly instantiated for float and double.
+template <typename SampleType>
+class BasicRingBuffer {
  public:
   /// @brief Default constructor: the user has to provide a fixed buffer length
-  explicit RingBuffer(const std::size_t capacity);
-  ~RingBuffer();
+  explicit BasicRingBuffer(const std::size_t capacity);
+  ~BasicRingBuffer();
 
   /// @brief Pop elements out of the buffer, with overlap
   ///
@@ -47,7 +50,7 @@ class RingBuffer {
   /// @param[out] dest    Buffer to store the elements into
   /// @param[in]  count   Elements count to retrieve
   /// @param[in]  overlap   Number of overlaps for filling the buffer
-  void PopOverlapped(float* dest,
+  void PopOverlapped(SampleType* dest,
                      const std::size_t count,
                      const unsigned int overlap);
 
@@ -59,23 +62,28 @@ class RingBuffer {
   ///
   /// @param[out] dest    Buffer to store the elements into
   /// @param[in]  count   Elements count to retrieve
-  void Pop(float* dest, const std::size_t count);
+  void Pop(SampleType* dest, const std::size_t count);
 
   /// @brief Push elements into the buffer
   ///
   /// @param[in]  src   Buffer to push
   /// @param[in]  count   Buffer elements count
-  void Push(const float* const src, const std::size_t count);
+  void Push(const SampleType* const src, const std::size_t count);
 
   /// @brief Fill "count" elements with the constant value "value"
   ///
   /// @param[in]  value   Value to push
   /// @param[in]  count   Buffer elements count
-  void Fill(const float value, const std::size_t count);
+  void Fill(const SampleType value, const std::size_t count);
 
   /// @brief Explicitly clear buffer content but does not deallocate it
   void Clear(void);
 
+  /// @brief Copy the given buffer content and positions
+  ///
+  /// Both buffers have to share the same capacity.
+  void CopyState(const BasicRingBuffer& other);
+
   /// @brief Returns true if the buffer is "usable"
   ///
   /// For now, this means that some memory is allocated
@@ -89,17 +97,20 @@ class RingBuffer {
 
  private:
   // No assignment operator for this class
-  RingBuffer& operator=(const RingBuffer& right);
+  BasicRingBuffer& operator=(const BasicRingBuffer& right);
   // No copy constructor for this class
-  RingBuffer(const RingBuffer& right);
+  BasicRingBuffer(const BasicRingBuffer& right);
 
-  float* data_;  ///< Internal elements buffer
+  SampleType* data_;  ///< Internal elements buffer
   std::size_t capacity_;  ///< Internal buffer length
   std::size_t size_;  ///< Count of elements currently held within the buffer
   std::size_t writing_position_;  ///< Beginning of the writing part
   std::size_t reading_position_;  ///< Beginning of the reading part
 };
 
+/// @brief Single precision ringbuffer, as used for all real-time processing
+typedef BasicRingBuffer<float> RingBuffer;
+
 }  // namespace algorithms
 }  // namespace chartreuse
 
@@ -0,0 +1,231 @@
+/// @file segmentstatistics.cc
+/// @brief Streaming segment statistics implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/segmentstatistics.h"
+
+// std::sort, std::fill
+#include <algorithm>
+// std::floor
+#include <cmath>
+// std::numeric_limits
+#include <limits>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+P2Quantile::P2Quantile(const float probability)
+    : probability_(probability),
+      count_(0),
+      heights_(),
+      positions_(),
+      desired_positions_(),
+      increments_() {
+  CHARTREUSE_ASSERT(probability > 0.0f);
+  CHARTREUSE_ASSERT(probability < 1.0f);
+  Reset();
+}
+
+void P2Quantile::Push(const float value) {
+  // Initialization: the first 5 observations are the markers
+  if (count_ < heights_.size()) {
+    heights_[count_] = value;
+    count_ += 1;
+    if (count_ == heights_.size()) {
+      std::sort(heights_.begin(), heights_.end());
+    }
+    return;
+  }
+  count_ += 1;
+  // Find the cell the observation lies in, updating the extreme markers
+  unsigned int cell(0);
+  if (value < heights_[0]) {
+    heights_[0] = value;
+  } else if (value >= heights_[4]) {
+    heights_[4] = value;
+    cell = 3;
+  } else {
+    while (value >= heights_[cell + 1]) {
+      cell += 1;
+    }
+  }
+  for (unsigned int marker_idx(cell + 1); marker_idx < 5; ++marker_idx) {
+    positions_[marker_idx] += 1.0f;
+  }
+  for (unsigned int marker_idx(0); marker_idx < 5; ++marker_idx) {
+    desired_positions_[marker_idx] += increments_[marker_idx];
+  }
+  for (unsigned int marker_idx(1); marker_idx < 4; ++marker_idx) {
+    AdjustMarker(marker_idx);
+  }
+}
+
+float P2Quantile::Value(void) const {
+  if (count_ >= heights_.size()) {
+    return heights_[2];
+  }
+  if (count_ == 0) {
+    return 0.0f;
+  }
+  // Not enough observations yet: exact quantile
+  std::array<float, 5> sorted(heights_);
+  std::sort(sorted.begin(), sorted.begin() + count_);
+  const std::size_t kIndex(static_cast<std::size_t>(
+    std::floor(probability_ * static_cast<float>(count_ - 1) + 0.5f)));
+  return sorted[kIndex];
+}
+
+void P2Quantile::Reset(void) {
+  count_ = 0;
+  heights_.fill(0.0f);
+  for (unsigned int marker_idx(0); marker_idx < 5; ++marker_idx) {
+    positions_[marker_idx] = static_cast<float>(marker_idx);
+  }
+  desired_positions_[0] = 0.0f;
+  desired_positions_[1] = 2.0f * probability_;
+  desired_positions_[2] = 4.0f * probability_;
+  desired_positions_[3] = 2.0f + 2.0f * probability_;
+  desired_positions_[4] = 4.0f;
+  increments_[0] = 0.0f;
+  increments_[1] = probability_ / 2.0f;
+  increments_[2] = probability_;
+  increments_[3] = (1.0f + probability_) / 2.0f;
+  increments_[4] = 1.0f;
+}
+
+void P2Quantile::AdjustMarker(const unsigned int marker_idx) {
+  const unsigned int i(marker_idx);
+  const float kDelta(desired_positions_[i] - positions_[i]);
+  const float kRightGap(positions_[i + 1] - positions_[i]);
+  const float kLeftGap(positions_[i - 1] - positions_[i]);
+  if (!(((kDelta >= 1.0f) && (kRightGap > 1.0f))
+        || ((kDelta <= -1.0f) && (kLeftGap < -1.0f)))) {
+    return;
+  }
+  const float kSign(kDelta > 0.0f ? 1.0f : -1.0f);
+  // Piecewise-parabolic prediction
+  const float kParabolic(heights_[i] + kSign
+    / (positions_[i + 1] - positions_[i - 1])
+    * ((positions_[i] - positions_[i - 1] + kSign)
+       * (heights_[i + 1] - heights_[i]) / kRightGap
+       + (kRightGap - kSign)
+       * (heights_[i] - heights_[i - 1]) / -kLeftGap));
+  if ((heights_[i - 1] < kParabolic) && (kParabolic < heights_[i + 1])) {
+    heights_[i] = kParabolic;
+  } else {
+    // Linear prediction otherwise
+    const unsigned int kNeighbour(kSign > 0.0f ? i + 1 : i - 1);
+    heights_[i] += kSign * (heights_[kNeighbour] - heights_[i])
+                   / (positions_[kNeighbour] - positions_[i]);
+  }
+  positions_[i] += kSign;
+}
+
+SegmentStatistics::SegmentStatistics(const unsigned int dimensions,
+                                     const std::vector<float>& quantiles)
+    : dimensions_(dimensions),
+      quantiles_count_(static_cast<unsigned int>(quantiles.size())),
+      count_(0),
+      mean_(dimensions),
+      m2_(dimensions),
+      min_(dimensions),
+      max_(dimensions),
+      quantiles_() {
+  CHARTREUSE_ASSERT(dimensions > 0);
+  quantiles_.reserve(dimensions * quantiles_count_);
+  for (unsigned int dimension(0); dimension < dimensions; ++dimension) {
+    for (const float probability : quantiles) {
+      quantiles_.push_back(P2Quantile(probability));
+    }
+  }
+  Reset();
+}
+
+void SegmentStatistics::Push(const float* const values) {
+  CHARTREUSE_ASSERT(values != nullptr);
+
+  count_ += 1;
+  const Eigen::Map<const Eigen::ArrayXf> input(values, dimensions_);
+  Eigen::Map<Eigen::ArrayXf> mean(&mean_[0], dimensions_);
+  const float kNormFactor(1.0f / static_cast<float>(count_));
+  // (x - previous_mean) * (x - mean) = (x - previous_mean)^2 * (1 - 1 / n),
+  // not to allocate any temporary
+  Eigen::Map<Eigen::ArrayXf>(&m2_[0], dimensions_)
+    += (input - mean).square() * (1.0f - kNormFactor);
+  mean += (input - mean) * kNormFactor;
+  Eigen::Map<Eigen::ArrayXf> min(&min_[0], dimensions_);
+  min = min.min(input);
+  Eigen::Map<Eigen::ArrayXf> max(&max_[0], dimensions_);
+  max = max.max(input);
+  for (unsigned int dimension(0); dimension < dimensions_; ++dimension) {
+    for (unsigned int quantile_idx(0);
+         quantile_idx < quantiles_count_;
+         ++quantile_idx) {
+      quantiles_[dimension * quantiles_count_ + quantile_idx].Push(
+        values[dimension]);
+    }
+  }
+}
+
+void SegmentStatistics::Summary(float* const output) const {
+  CHARTREUSE_ASSERT(output != nullptr);
+
+  const unsigned int kStride(Statistic::kCount + quantiles_count_);
+  const bool kEmpty(count_ == 0);
+  const float kNormFactor(kEmpty ? 0.0f : 1.0f / static_cast<float>(count_));
+  for (unsigned int dimension(0); dimension < dimensions_; ++dimension) {
+    float* const dimension_output(&output[dimension * kStride]);
+    dimension_output[Statistic::kMean] = mean_[dimension];
+    dimension_output[Statistic::kVariance] = m2_[dimension] * kNormFactor;
+    dimension_output[Statistic::kMin] = kEmpty ? 0.0f : min_[dimension];
+    dimension_output[Statistic::kMax] = kEmpty ? 0.0f : max_[dimension];
+    for (unsigned int quantile_idx(0);
+         quantile_idx < quantiles_count_;
+         ++quantile_idx) {
+      dimension_output[Statistic::kCount + quantile_idx]
+        = quantiles_[dimension * quantiles_count_ + quantile_idx].Value();
+    }
+  }
+}
+
+unsigned int SegmentStatistics::SummaryLength(void) const {
+  return dimensions_ * (Statistic::kCount + quantiles_count_);
+}
+
+std::size_t SegmentStatistics::Count(void) const {
+  return count_;
+}
+
+void SegmentStatistics::Reset(void) {
+  count_ = 0;
+  std::fill(mean_.begin(), mean_.end(), 0.0f);
+  std::fill(m2_.begin(), m2_.end(), 0.0f);
+  std::fill(min_.begin(), min_.end(), std::numeric_limits<float>::max());
+  std::fill(max_.begin(), max_.end(), -std::numeric_limits<float>::max());
+  for (P2Quantile& quantile : quantiles_) {
+    quantile.Reset();
+  }
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
@@ -0,0 +1,128 @@
+/// @file segmentstatistics.h
+/// @brief Streaming segment statistics declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_SEGMENTSTATISTICS_H_
+#define CHARTREUSE_SRC_ALGORITHMS_SEGMENTSTATISTICS_H_
+
+// std::array
+#include <array>
+// std::size_t
+#include <cstddef>
+// std::vector
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+// Using the namespace trick for easier enum scoping
+namespace Statistic {
+
+/// @brief Layout of each dimension summary, quantiles being appended
+enum Type {
+  kMean = 0,
+  kVariance,
+  kMin,
+  kMax,
+  kCount
+};
+
+}  // namespace Statistic
+
+/// @brief P-square streaming quantile estimator (Jain & Chlamtac)
+///
+/// Only 5 markers are kept whatever the observations count,
+/// their heights being adjusted by piecewise-parabolic interpolation.
+class P2Quantile {
+ public:
+  /// @brief Default constructor
+  ///
+  /// @param[in]  probability   Quantile to be estimated, within ]0 ; 1[
+  explicit P2Quantile(const float probability);
+
+  /// @brief Update the estimation with the given observation
+  void Push(const float value);
+
+  /// @brief Retrieve the current estimation
+  float Value(void) const;
+
+  /// @brief Forget all previous observations
+  void Reset(void);
+
+ private:
+  /// @brief Adjust the given marker height and position
+  void AdjustMarker(const unsigned int marker_idx);
+
+  float probability_;
+  std::size_t count_;  ///< Observations count
+  std::array<float, 5> heights_;  ///< Markers heights
+  std::array<float, 5> positions_;  ///< Markers actual positions
+  std::array<float, 5> desired_positions_;  ///< Markers desired positions
+  std::array<float, 5> increments_;  ///< Desired positions increments
+};
+
+/// @brief Streaming statistics over a segment of multi-dimensional
+/// observations: per-dimension mean, variance, min, max and quantiles
+///
+/// Mean and variance are accumulated with Welford's method, all dimensions
+/// being updated at once; quantiles are estimated by P-square.
+class SegmentStatistics {
+ public:
+  /// @brief Default constructor
+  ///
+  /// @param[in]  dimensions   Observations dimensionality
+  /// @param[in]  quantiles   Probabilities of the quantiles to be estimated
+  explicit SegmentStatistics(const unsigned int dimensions,
+                             const std::vector<float>& quantiles);
+
+  /// @brief Update all statistics with the given observation
+  ///
+  /// @param[in]  values   Observation, one value per dimension
+  void Push(const float* const values);
+
+  /// @brief Retrieve all statistics
+  ///
+  /// @param[out]  output   For each dimension in a row, mean, variance,
+  /// min and max then quantiles: of SummaryLength()
+  void Summary(float* const output) const;
+
+  /// @brief Length of the summary output
+  unsigned int SummaryLength(void) const;
+
+  /// @brief Observations count since the last reset
+  std::size_t Count(void) const;
+
+  /// @brief Forget all previous observations
+  void Reset(void);
+
+ private:
+  const unsigned int dimensions_;
+  const unsigned int quantiles_count_;
+  std::size_t count_;
+  std::vector<float> mean_;
+  std::vector<float> m2_;  ///< Sum of squared differences from the mean
+  std::vector<float> min_;
+  std::vector<float> max_;
+  std::vector<P2Quantile> quantiles_;  ///< For each dimension in a row
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_SEGMENTSTATISTICS_H_
@@ -0,0 +1,198 @@
+/// @file spectralflatness.cc
+/// @brief Per-band spectral flatness implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/spectralflatness.h"
+
+// std::max, std::min
+#include <algorithm>
+// std::ceil, std::floor, std::pow
+#include <cmath>
+// std::memcpy
+#include <cstring>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/algorithms/algorithms_common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Length of the fixed-size arrays the logarithm is computed on
+static const unsigned int kLogChunkLength(16);
+
+typedef Eigen::Array<float, kLogChunkLength, 1> LogChunk;
+typedef Eigen::Array<int, kLogChunkLength, 1> LogChunkBits;
+
+static_assert(sizeof(int) == sizeof(float),
+              "Float bits cannot be reinterpreted as integers");
+
+/// @brief Float representation of 1, e.g. the exponent bias alone
+static const int kExponentBias(0x3F800000);
+
+/// @brief log2(1 + x) polynomial approximation, x within [0 ; 1[
+///
+/// Shared by the scalar and array implementations.
+template <typename Type>
+static inline Type LogTwoMantissa(const Type& x) {
+  return x * (1.44196558f
+         + x * (-0.709662795f
+         + x * (0.417595625f
+         + x * (-0.196269453f
+         + x * 0.0463852845f))));
+}
+
+/// @brief FastLogTwo() actual implementation, on a whole chunk
+static inline LogChunk FastLogTwoChunk(const LogChunk& values) {
+  LogChunkBits bits;
+  std::memcpy(bits.data(), values.data(), sizeof(bits));
+  // Positive values: the sign bit is null, the biased exponent lies right
+  // after it
+  const LogChunkBits kBiasedExponent(bits.shiftRight<23>());
+  // Replacing the exponent by the bias leaves the mantissa within [1 ; 2[
+  bits += kExponentBias - kBiasedExponent.shiftLeft<23>();
+  LogChunk x;
+  std::memcpy(x.data(), bits.data(), sizeof(x));
+  x -= 1.0f;
+  return (kBiasedExponent - 127).cast<float>() + LogTwoMantissa(x);
+}
+
+/// @brief Sum of the logarithms of the given values, floored
+static float FlooredLogTwoSum(const float* const values,
+                              const unsigned int length,
+                              const float floor) {
+  float log_sum(0.0f);
+  unsigned int index(0);
+  while (index + kLogChunkLength <= length) {
+    log_sum += FastLogTwoChunk(
+      Eigen::Map<const LogChunk>(&values[index]).max(floor)).sum();
+    index += kLogChunkLength;
+  }
+  if (index < length) {
+    // Padding with ones, which logarithm is null
+    LogChunk tail(LogChunk::Ones());
+    tail.head(length - index)
+      = Eigen::Map<const Eigen::ArrayXf>(&values[index],
+                                         length - index).max(floor);
+    log_sum += FastLogTwoChunk(tail).sum();
+  }
+  return log_sum;
+}
+
+void FastLogTwo(const float* const input,
+                const std::size_t length,
+                float* const output) {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+
+  std::size_t index(0);
+  while (index + kLogChunkLength <= length) {
+    Eigen::Map<LogChunk> chunk(&output[index]);
+    chunk = FastLogTwoChunk(Eigen::Map<const LogChunk>(&input[index]));
+    index += kLogChunkLength;
+  }
+  if (index < length) {
+    const std::size_t kTailLength(length - index);
+    LogChunk tail(LogChunk::Ones());
+    tail.head(kTailLength) = Eigen::Map<const Eigen::ArrayXf>(&input[index],
+                                                              kTailLength);
+    Eigen::Map<Eigen::ArrayXf>(&output[index], kTailLength)
+      = FastLogTwoChunk(tail).head(kTailLength);
+  }
+}
+
+float FastLogTwo(const float value) {
+  CHARTREUSE_ASSERT(value > 0.0f);
+  int bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const int kBiasedExponent(bits >> 23);
+  bits += kExponentBias - (kBiasedExponent << 23);
+  float mantissa;
+  std::memcpy(&mantissa, &bits, sizeof(mantissa));
+  return static_cast<float>(kBiasedExponent - 127)
+    + LogTwoMantissa(mantissa - 1.0f);
+}
+
+FlatnessBands::FlatnessBands(const float resolution,
+                             const float overlap,
+                             const float low_freq,
+                             const float high_freq,
+                             const float power_floor,
+                             const unsigned int dft_length,
+                             const float sampling_freq)
+    : power_floor_(power_floor),
+      starts_(),
+      lengths_() {
+  CHARTREUSE_ASSERT(resolution > 0.0f);
+  CHARTREUSE_ASSERT(overlap >= 0.0f);
+  CHARTREUSE_ASSERT(overlap < 1.0f);
+  CHARTREUSE_ASSERT(low_freq > 0.0f);
+  CHARTREUSE_ASSERT(high_freq > low_freq);
+  CHARTREUSE_ASSERT(power_floor > 0.0f);
+  CHARTREUSE_ASSERT(dft_length > 0);
+  CHARTREUSE_ASSERT(sampling_freq > 0.0f);
+
+  const unsigned int kSpectrumLength(dft_length / 2 + 1);
+  const float kBinWidth(sampling_freq / dft_length);
+  // The last band extended higher edge has to lie below Nyquist
+  const float kHighFreq(std::min(high_freq,
+                                 sampling_freq / (2.0f * (1.0f + overlap))));
+  CHARTREUSE_ASSERT(kHighFreq > low_freq);
+  const unsigned int kBandsCount(static_cast<unsigned int>(
+    std::floor(LogTwo(kHighFreq / low_freq) / resolution + 1e-4f)));
+  for (unsigned int band(0); band < kBandsCount; ++band) {
+    const float kLow(low_freq * std::pow(2.0f, band * resolution));
+    const float kHigh(low_freq * std::pow(2.0f, (band + 1) * resolution));
+    const unsigned int kFirst(static_cast<unsigned int>(
+      std::ceil(kLow * (1.0f - overlap) / kBinWidth)));
+    const unsigned int kLast(std::min(static_cast<unsigned int>(
+      std::floor(kHigh * (1.0f + overlap) / kBinWidth)), kSpectrumLength - 1));
+    starts_.push_back(kFirst);
+    // At least one bin per band
+    lengths_.push_back(std::max(kLast, kFirst) - kFirst + 1);
+  }
+}
+
+void FlatnessBands::Process(const float* const spectrum_power,
+                            float* const output) const {
+  CHARTREUSE_ASSERT(spectrum_power != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrum_power != output);
+
+  for (unsigned int band(0); band < BandsCount(); ++band) {
+    const float* const kBand(&spectrum_power[starts_[band]]);
+    const unsigned int kLength(lengths_[band]);
+    const float log_sum(FlooredLogTwoSum(kBand, kLength, power_floor_));
+    const float sum(Eigen::Map<const Eigen::ArrayXf>(kBand, kLength)
+                      .max(power_floor_).sum());
+    // Geometric mean: a single exponentiation per band
+    const float kGeometricMean(std::pow(2.0f, log_sum / kLength));
+    const float kArithmeticMean(sum / kLength);
+    // The approximation may give slightly more than 1 for flat bands
+    output[band] = std::min(kGeometricMean / kArithmeticMean, 1.0f);
+  }
+}
+
+unsigned int FlatnessBands::BandsCount(void) const {
+  return static_cast<unsigned int>(starts_.size());
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
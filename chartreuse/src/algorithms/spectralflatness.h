@@ -0,0 +1,99 @@
+/// @file spectralflatness.h
+/// @brief Per-band spectral flatness declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_SPECTRALFLATNESS_H_
+#define CHARTREUSE_SRC_ALGORITHMS_SPECTRALFLATNESS_H_
+
+// std::size_t
+#include <cstddef>
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Maximum absolute error of FastLogTwo(), for any normal input
+static const float kFastLogTwoMaxError(2e-5f);
+
+/// @brief Fast base 2 logarithm approximation, for a whole array:
+/// the exponent is read directly from the float representation, the log of
+/// the mantissa within [1 ; 2[ is approximated by a 5th order polynomial
+/// (least maximum error fit).
+///
+/// Computation is done on fixed-size Eigen arrays, only made of integer and
+/// arithmetic packet operations.
+/// Absolute error is bounded by kFastLogTwoMaxError, for normal (strictly
+/// positive, not denormal) inputs only.
+///
+/// @param[in]  input   Values to compute the logarithm of
+/// @param[in]  length   Input (and output) length
+/// @param[out]  output   Base 2 logarithm of each input value
+void FastLogTwo(const float* const input,
+                const std::size_t length,
+                float* const output);
+
+/// @brief Same as above, for a single value (not vectorized)
+float FastLogTwo(const float value);
+
+/// @brief Spectral flatness bands: for each band, the ratio between the
+/// geometric and arithmetic means of the spectrum power bins within it
+///
+/// Bands are logarithmic, of the given octave resolution, and may overlap:
+/// each one is extended on both sides by a fraction of its edges,
+/// as defined by MPEG-7.
+/// All bins lower than the given floor are considered to be equal to it,
+/// which defines silent bands as flat ones.
+class FlatnessBands {
+ public:
+  /// @brief Default constructor, computes the bands tables
+  ///
+  /// @param[in]  resolution   Bands width, in octaves
+  /// @param[in]  overlap   Bands relative extension on both sides
+  /// @param[in]  low_freq   Lower nominal edge of the first band
+  /// @param[in]  high_freq   Maximum higher nominal edge of the last band
+  /// @param[in]  power_floor   Minimum bin power to be considered
+  /// @param[in]  dft_length   Length of the Dft the spectrum comes from
+  /// @param[in]  sampling_freq   Analysis sampling frequency
+  explicit FlatnessBands(const float resolution,
+                         const float overlap,
+                         const float low_freq,
+                         const float high_freq,
+                         const float power_floor,
+                         const unsigned int dft_length,
+                         const float sampling_freq);
+
+  /// @brief Compute the flatness of each band for the given power spectrum
+  ///
+  /// @param[in]  spectrum_power   Power spectrum, of (dft_length / 2 + 1)
+  /// @param[out]  output   Bands flatness within [0 ; 1], of BandsCount()
+  void Process(const float* const spectrum_power, float* const output) const;
+
+  /// @brief Number of bands
+  unsigned int BandsCount(void) const;
+
+ private:
+  const float power_floor_;
+  std::vector<unsigned int> starts_;  ///< First bin of each band
+  std::vector<unsigned int> lengths_;  ///< Bins count of each band
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_SPECTRALFLATNESS_H_
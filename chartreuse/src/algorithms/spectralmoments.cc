@@ -0,0 +1,396 @@
+/// @file spectralmoments.cc
+/// @brief Spectral moments algorithm implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/spectralmoments.h"
+
+// std::min, std::max
+#include <algorithm>
+// std::sqrt
+#include <cmath>
+// std::complex
+#include <complex>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/algorithms/workspace.h"
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/interface/analysiscontext.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Packed type used for the moments accumulation
+typedef Eigen::Array<float, 4, 1> MomentsPacket;
+
+/// @brief Variance under which the distribution is considered degenerate,
+/// hence its skewness and kurtosis undefined
+static const double kMinVariance(1e-6);
+
+/// @brief Main loop body: accumulate one packet contribution to all orders
+static inline void AccumulateMoments(const MomentsPacket& power,
+                                     const MomentsPacket& freq,
+                                     MomentsPacket* const sums) {
+  const MomentsPacket kWeighted1(power * freq);
+  const MomentsPacket kWeighted2(kWeighted1 * freq);
+  const MomentsPacket kWeighted3(kWeighted2 * freq);
+  sums[0] += power;
+  sums[1] += kWeighted1;
+  sums[2] += kWeighted2;
+  sums[3] += kWeighted3;
+  sums[4] += kWeighted3 * freq;
+}
+
+/// @brief Raw moments count, from the 0th to the 4th order
+static const unsigned int kRawMomentsCount(5);
+
+/// @brief Batched moments computation granularity, in frames
+static const unsigned int kMomentsBatchTile(16);
+
+/// @brief Moments computation end, from the raw moments of all bins:
+/// normalization and central moments derivation
+static void FinalizeMoments(const double* const raw,
+                            const float normalization_factor,
+                            float* const moments) {
+  // Normalization
+  const double kScale(2.0 / normalization_factor);
+  const double kPowerSum(raw[0] * kScale
+    // Prevent divide by zero
+    + 1e-7);
+  CHARTREUSE_ASSERT(kPowerSum > 0.0);
+  const double kNormFactor(kScale / kPowerSum);
+  const double kMu0(raw[0] * kNormFactor);
+  const double kMu1(raw[1] * kNormFactor);
+  const double kMu2(raw[2] * kNormFactor);
+  const double kMu3(raw[3] * kNormFactor);
+  const double kMu4(raw[4] * kNormFactor);
+
+  // Central moments from raw ones
+  const double kCentroid(kMu1);
+  const double kCentroid2(kCentroid * kCentroid);
+  const double kVariance(std::max(0.0,
+                                  kMu2
+                                  - 2.0 * kCentroid * kMu1
+                                  + kCentroid2 * kMu0));
+  const double kThird(kMu3
+                      - 3.0 * kCentroid * kMu2
+                      + 3.0 * kCentroid2 * kMu1
+                      - kCentroid2 * kCentroid * kMu0);
+  const double kFourth(kMu4
+                       - 4.0 * kCentroid * kMu3
+                       + 6.0 * kCentroid2 * kMu2
+                       - 4.0 * kCentroid2 * kCentroid * kMu1
+                       + kCentroid2 * kCentroid2 * kMu0);
+  const double kSpread(std::sqrt(kVariance));
+
+  moments[SpectralMoment::kCentroid] = static_cast<float>(kCentroid);
+  moments[SpectralMoment::kSpread] = static_cast<float>(kSpread);
+  if (kVariance > kMinVariance) {
+    const double kSkewness(kThird / (kVariance * kSpread));
+    const double kKurtosis(kFourth / (kVariance * kVariance));
+    moments[SpectralMoment::kSkewness] = static_cast<float>(
+      std::min(std::max(kSkewness, -static_cast<double>(kMaxSkewness)),
+               static_cast<double>(kMaxSkewness)));
+    moments[SpectralMoment::kKurtosis] = static_cast<float>(
+      std::min(kKurtosis, static_cast<double>(kMaxKurtosis)));
+  } else {
+    moments[SpectralMoment::kSkewness] = 0.0f;
+    moments[SpectralMoment::kKurtosis] = 0.0f;
+  }
+}
+
+/// @brief Common moments computation end, once the main loop is done:
+/// horizontal reduction of the packed sums, remaining bins and low bins
+/// contributions, then FinalizeMoments()
+static void ReduceMoments(const MomentsPacket* const sums,
+                          const float* const power,
+                          const float* const scale,
+                          const unsigned int packed_count,
+                          const unsigned int bins_count,
+                          const float low_power,
+                          const float low_freq,
+                          const float normalization_factor,
+                          float* const moments) {
+  // Horizontal reduction - from here on everything is scalar
+  double raw[5] = {sums[0].sum(),
+                   sums[1].sum(),
+                   sums[2].sum(),
+                   sums[3].sum(),
+                   sums[4].sum()};
+  for (unsigned int i(packed_count); i < bins_count; ++i) {
+    double weighted(power[i]);
+    for (unsigned int order(0); order < 5; ++order) {
+      raw[order] += weighted;
+      weighted *= scale[i];
+    }
+  }
+  double low_weighted(low_power);
+  for (unsigned int order(0); order < 5; ++order) {
+    raw[order] += low_weighted;
+    low_weighted *= low_freq;
+  }
+
+  FinalizeMoments(raw, normalization_factor, moments);
+}
+
+
+void ComputeSpectralMoments(const float* const spectrogram_power,
+                            const float* const frequency_scale,
+                            const unsigned int low_edge_idx,
+                            const unsigned int high_edge_idx,
+                            const float normalization_factor,
+                            float* const moments) {
+  CHARTREUSE_ASSERT(spectrogram_power != nullptr);
+  CHARTREUSE_ASSERT(frequency_scale != nullptr);
+  CHARTREUSE_ASSERT(spectrogram_power != frequency_scale);
+  CHARTREUSE_ASSERT(low_edge_idx > 0);
+  CHARTREUSE_ASSERT(high_edge_idx > 0);
+  CHARTREUSE_ASSERT(high_edge_idx > low_edge_idx);
+  CHARTREUSE_ASSERT(normalization_factor > 0.0f);
+  CHARTREUSE_ASSERT(moments != nullptr);
+
+  // Summing the contributions of all frequencies lower than the low edge
+  // The DC component is unchanged, everything else is doubled
+  float low_power(0.5f * spectrogram_power[0]);
+  for (unsigned int i(1); i < low_edge_idx; ++i) {
+    low_power += spectrogram_power[i];
+  }
+
+  // Main loop: the first bin of the scale is the low edge one
+  const float* const power(&spectrogram_power[low_edge_idx]);
+  const float* const scale(&frequency_scale[1]);
+  const unsigned int kBinsCount(high_edge_idx - low_edge_idx);
+  const unsigned int kPacketSize(MomentsPacket::RowsAtCompileTime);
+  const unsigned int kPackedCount(kBinsCount - kBinsCount % kPacketSize);
+  MomentsPacket sums[5];
+  for (unsigned int order(0); order < 5; ++order) {
+    sums[order].setZero();
+  }
+  for (unsigned int i(0); i < kPackedCount; i += kPacketSize) {
+    AccumulateMoments(Eigen::Map<const MomentsPacket>(&power[i]),
+                      Eigen::Map<const MomentsPacket>(&scale[i]),
+                      sums);
+  }
+  ReduceMoments(sums,
+                power,
+                scale,
+                kPackedCount,
+                kBinsCount,
+                low_power,
+                frequency_scale[0],
+                normalization_factor,
+                moments);
+}
+
+void ComputeSpectrumPowerAndMoments(const float* const dft,
+                                    const unsigned int spectrum_length,
+                                    const float* const frequency_scale,
+                                    const unsigned int low_edge_idx,
+                                    const unsigned int high_edge_idx,
+                                    const float normalization_factor,
+                                    float* const spectrogram_power,
+                                    float* const moments) {
+  CHARTREUSE_ASSERT(dft != nullptr);
+  CHARTREUSE_ASSERT(frequency_scale != nullptr);
+  CHARTREUSE_ASSERT(low_edge_idx > 0);
+  CHARTREUSE_ASSERT(high_edge_idx > low_edge_idx);
+  CHARTREUSE_ASSERT(high_edge_idx <= spectrum_length);
+  CHARTREUSE_ASSERT(normalization_factor > 0.0f);
+  CHARTREUSE_ASSERT(spectrogram_power != nullptr);
+  CHARTREUSE_ASSERT(moments != nullptr);
+  CHARTREUSE_ASSERT(dft != spectrogram_power);
+
+  typedef Eigen::Array<std::complex<float>, 4, 1> ComplexPacket;
+  const std::complex<float>* const bins(
+    reinterpret_cast<const std::complex<float>*>(dft));
+
+  // Bins lower than the low edge, same as ComputeSpectralMoments()
+  Eigen::Map<Eigen::ArrayXf>(spectrogram_power, low_edge_idx)
+    = Eigen::Map<const Eigen::ArrayXcf>(bins, low_edge_idx).abs2();
+  float low_power(0.5f * spectrogram_power[0]);
+  for (unsigned int i(1); i < low_edge_idx; ++i) {
+    low_power += spectrogram_power[i];
+  }
+
+  // Main loop: each power packet is written out and accumulated right away
+  float* const power(&spectrogram_power[low_edge_idx]);
+  const float* const scale(&frequency_scale[1]);
+  const unsigned int kBinsCount(high_edge_idx - low_edge_idx);
+  const unsigned int kPacketSize(MomentsPacket::RowsAtCompileTime);
+  const unsigned int kPackedCount(kBinsCount - kBinsCount % kPacketSize);
+  MomentsPacket sums[5];
+  for (unsigned int order(0); order < 5; ++order) {
+    sums[order].setZero();
+  }
+  for (unsigned int i(0); i < kPackedCount; i += kPacketSize) {
+    const MomentsPacket kPower(Eigen::Map<const ComplexPacket>(
+      &bins[low_edge_idx + i]).abs2());
+    Eigen::Map<MomentsPacket> power_packet(&power[i]);
+    power_packet = kPower;
+    AccumulateMoments(kPower,
+                      Eigen::Map<const MomentsPacket>(&scale[i]),
+                      sums);
+  }
+  // Remaining bins, including the ones above the high edge
+  const unsigned int kRemainingCount(spectrum_length
+                                     - low_edge_idx
+                                     - kPackedCount);
+  Eigen::Map<Eigen::ArrayXf>(&power[kPackedCount], kRemainingCount)
+    = Eigen::Map<const Eigen::ArrayXcf>(&bins[low_edge_idx + kPackedCount],
+                                        kRemainingCount).abs2();
+  ReduceMoments(sums,
+                power,
+                scale,
+                kPackedCount,
+                kBinsCount,
+                low_power,
+                frequency_scale[0],
+                normalization_factor,
+                moments);
+}
+
+SpectralMoments::SpectralMoments(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      normalization_factor_(manager->Context().SpectrumNormalization()) {
+  // Nothing to do here for now
+}
+
+void SpectralMoments::operator()(float* const output) {
+  if (!manager_->IsDescriptorComputed(
+        interface::DescriptorId::kSpectrogramPower)) {
+    // Retrieve the Dft first, so that nothing else is computed in between
+    const float* const dft(
+      manager_->GetDescriptor(interface::DescriptorId::kDft));
+    ComputeSpectrumPowerAndMoments(
+      dft,
+      manager_->AnalysisParameters().dft_length / 2 + 1,
+      manager_->FrequencyScale(),
+      manager_->AnalysisParameters().low_edge,
+      manager_->AnalysisParameters().high_edge,
+      normalization_factor_,
+      manager_->ProvideDescriptor(interface::DescriptorId::kSpectrogramPower),
+      output);
+    return;
+  }
+  Process(manager_->GetDescriptor(interface::DescriptorId::kSpectrogramPower),
+          manager_->FrequencyScale(),
+          manager_->AnalysisParameters().low_edge,
+          manager_->AnalysisParameters().high_edge,
+          output);
+}
+
+void SpectralMoments::Process(const float* const spectrogram_power,
+                              const float* const frequency_scale,
+                              const unsigned int low_edge_idx,
+                              const unsigned int high_edge_idx,
+                              float* const output) {
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrogram_power != output);
+
+  ComputeSpectralMoments(spectrogram_power,
+                         frequency_scale,
+                         low_edge_idx,
+                         high_edge_idx,
+                         normalization_factor_,
+                         output);
+}
+
+void SpectralMoments::Process(const float* const spectrogram_power,
+                              const std::size_t frames_count,
+                              const std::size_t frame_stride,
+                              const float* const frequency_scale,
+                              const unsigned int low_edge_idx,
+                              const unsigned int high_edge_idx,
+                              float* const output) {
+  CHARTREUSE_ASSERT(spectrogram_power != nullptr);
+  CHARTREUSE_ASSERT(frames_count > 0);
+  CHARTREUSE_ASSERT(frame_stride >= high_edge_idx);
+  CHARTREUSE_ASSERT(frequency_scale != nullptr);
+  CHARTREUSE_ASSERT(low_edge_idx > 0);
+  CHARTREUSE_ASSERT(high_edge_idx > low_edge_idx);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrogram_power != output);
+
+  // The frequency scale powers are shared by all frames: they are computed
+  // once, raw moments of a whole tile of frames being then a single
+  // matrix product
+  const unsigned int kBinsCount(high_edge_idx - low_edge_idx);
+  Workspace::Scope scope(&manager_->Scratch());
+  Eigen::Map<Eigen::MatrixXf> scale_powers(
+    scope.Floats(kRawMomentsCount * kBinsCount),
+    kRawMomentsCount,
+    kBinsCount);
+  scale_powers.row(0).setOnes();
+  const Eigen::Map<const Eigen::RowVectorXf> scale(&frequency_scale[1],
+                                                   kBinsCount);
+  for (unsigned int order(1); order < kRawMomentsCount; ++order) {
+    scale_powers.row(order) = scale_powers.row(order - 1).cwiseProduct(scale);
+  }
+  const Eigen::Map<const Eigen::MatrixXf, 0, Eigen::OuterStride<> > frames(
+    &spectrogram_power[low_edge_idx],
+    kBinsCount,
+    frames_count,
+    Eigen::OuterStride<>(frame_stride));
+
+  typedef Eigen::Matrix<float,
+                        kRawMomentsCount,
+                        Eigen::Dynamic,
+                        Eigen::ColMajor,
+                        kRawMomentsCount,
+                        kMomentsBatchTile> TileSums;
+  TileSums sums;
+  for (std::size_t first(0); first < frames_count; first += kMomentsBatchTile) {
+    const std::size_t kTileLength(
+      std::min(static_cast<std::size_t>(kMomentsBatchTile),
+               frames_count - first));
+    sums.resize(kRawMomentsCount, kTileLength);
+    sums.noalias() = scale_powers * frames.middleCols(first, kTileLength);
+    for (std::size_t tile_idx(0); tile_idx < kTileLength; ++tile_idx) {
+      const float* const power(
+        &spectrogram_power[(first + tile_idx) * frame_stride]);
+      // Bins lower than the low edge, same as ComputeSpectralMoments()
+      float low_power(0.5f * power[0]);
+      for (unsigned int i(1); i < low_edge_idx; ++i) {
+        low_power += power[i];
+      }
+      double raw[kRawMomentsCount];
+      double low_weighted(low_power);
+      for (unsigned int order(0); order < kRawMomentsCount; ++order) {
+        raw[order] = sums(order, tile_idx) + low_weighted;
+        low_weighted *= frequency_scale[0];
+      }
+      FinalizeMoments(raw,
+                      normalization_factor_,
+                      &output[(first + tile_idx) * SpectralMoment::kCount]);
+    }
+  }
+}
+
+descriptors::Descriptor_Meta SpectralMoments::Meta(void) const {
+  return descriptors::Descriptor_Meta(
+    SpectralMoment::kCount,
+    // Actually the skewness lower bound
+    -kMaxSkewness,
+    // Actually the kurtosis higher bound
+    kMaxKurtosis);
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
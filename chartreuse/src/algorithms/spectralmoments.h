@@ -0,0 +1,137 @@
+/// @file spectralmoments.h
+/// @brief Spectral moments algorithm declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_SPECTRALMOMENTS_H_
+#define CHARTREUSE_SRC_ALGORITHMS_SPECTRALMOMENTS_H_
+
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Spectral moments output layout
+// Using the namespace trick...
+namespace SpectralMoment {
+enum Type {
+  kCentroid = 0,
+  kSpread,
+  kSkewness,
+  kKurtosis,
+  kCount
+};
+}
+
+/// @brief Output bounds for the standardized moments
+///
+/// Nearly degenerate spectra (e.g. a pure tone) have unbounded skewness
+/// and kurtosis, they are clamped within these
+static const float kMaxSkewness(100.0f);
+static const float kMaxKurtosis(10000.0f);
+
+/// @brief Single pass spectral moments kernel
+///
+/// Walk the power spectrum and the frequency scale once, accumulating
+/// the 0th to 4th raw moments into packed registers; central moments are
+/// then derived from these. All bins lower than the low edge are gathered
+/// into the first frequency scale bin.
+///
+/// @param[in]  spectrogram_power   Power spectrum, of at least high_edge_idx
+/// @param[in]  frequency_scale   Frequency scale, of (high - low edge + 1)
+/// @param[in]  low_edge_idx   Lower Dft bin index to be considered
+/// @param[in]  high_edge_idx   Higher Dft bin index to be considered
+/// @param[in]  normalization_factor   Power spectrum normalization
+/// @param[out]  moments   Output, of SpectralMoment::kCount elements
+void ComputeSpectralMoments(const float* const spectrogram_power,
+                            const float* const frequency_scale,
+                            const unsigned int low_edge_idx,
+                            const unsigned int high_edge_idx,
+                            const float normalization_factor,
+                            float* const moments);
+
+/// @brief Fused power spectrum and spectral moments kernel
+///
+/// Same as ComputeSpectralMoments(), the power spectrum being computed
+/// from the Dft within the same traversal: each bin is loaded only once,
+/// its power written out while accumulating the moments.
+///
+/// @param[in]  dft   Interleaved complex Dft, of spectrum_length
+/// @param[in]  spectrum_length   Complex spectrum length
+/// @param[in]  frequency_scale   Frequency scale, of (high - low edge + 1)
+/// @param[in]  low_edge_idx   Lower Dft bin index to be considered
+/// @param[in]  high_edge_idx   Higher Dft bin index to be considered
+/// @param[in]  normalization_factor   Power spectrum normalization
+/// @param[out]  spectrogram_power   Power spectrum, of spectrum_length
+/// @param[out]  moments   Output, of SpectralMoment::kCount elements
+void ComputeSpectrumPowerAndMoments(const float* const dft,
+                                    const unsigned int spectrum_length,
+                                    const float* const frequency_scale,
+                                    const unsigned int low_edge_idx,
+                                    const unsigned int high_edge_idx,
+                                    const float normalization_factor,
+                                    float* const spectrogram_power,
+                                    float* const moments);
+
+/// @brief Compute centroid, spread, skewness and kurtosis of the spectrum
+/// over the manager frequency scale, all in one traversal.
+///
+/// Output layout is given by SpectralMoment::Type.
+///
+/// If the power spectrum was not retrieved yet for the current frame,
+/// it is computed along with the moments by the fused kernel.
+class SpectralMoments : public descriptors::Descriptor_Interface {
+ public:
+  explicit SpectralMoments(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const spectrogram_power,
+               const float* const frequency_scale,
+               const unsigned int low_edge_idx,
+               const unsigned int high_edge_idx,
+               float* const output);
+
+  /// @brief Batched process method: same as above for frames_count power
+  /// spectra, the i-th one starting at spectrogram_power[i * frame_stride]
+  ///
+  /// Moments of each spectrum are written one after the other.
+  void Process(const float* const spectrogram_power,
+               const std::size_t frames_count,
+               const std::size_t frame_stride,
+               const float* const frequency_scale,
+               const unsigned int low_edge_idx,
+               const unsigned int high_edge_idx,
+               float* const output);
+
+  descriptors::Descriptor_Meta Meta(void) const;
+
+ private:
+  // No assignment operator for this class
+  SpectralMoments& operator=(const SpectralMoments& right);
+
+  const float normalization_factor_;
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_SPECTRALMOMENTS_H_
@@ -0,0 +1,124 @@
+/// @file spectrumhistory.cc
+/// @brief Past spectra history implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/spectrumhistory.h"
+
+// std::fill
+#include <algorithm>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+SpectrumHistory::SpectrumHistory(const unsigned int spectrum_length,
+                                 const unsigned int depth)
+    : spectrum_length_(spectrum_length),
+      depth_(depth),
+      latest_slot_(0),
+      count_(0),
+      is_active_(false),
+      spectra_(spectrum_length * depth),
+      magnitudes_(spectrum_length * depth, 0.0f),
+      log_magnitudes_(spectrum_length * depth, 0.0f) {
+  CHARTREUSE_ASSERT(spectrum_length > 0);
+  CHARTREUSE_ASSERT(depth > 0);
+}
+
+void SpectrumHistory::Push(const float* const spectrum) {
+  CHARTREUSE_ASSERT(spectrum != nullptr);
+
+  latest_slot_ = (latest_slot_ + 1) % depth_;
+  if (count_ < depth_) {
+    count_ += 1;
+  }
+  const unsigned int kOffset(latest_slot_ * spectrum_length_);
+  Eigen::Map<Eigen::ArrayXcf> spectrum_map(&spectra_[kOffset],
+                                           spectrum_length_);
+  spectrum_map = Eigen::Map<const Eigen::ArrayXcf>(
+    reinterpret_cast<const std::complex<float>*>(spectrum),
+    spectrum_length_);
+  Eigen::Map<Eigen::ArrayXf> magnitudes_map(&magnitudes_[kOffset],
+                                            spectrum_length_);
+  magnitudes_map = spectrum_map.abs();
+  Eigen::Map<Eigen::ArrayXf>(&log_magnitudes_[kOffset], spectrum_length_)
+    = (magnitudes_map + 1.0f).log();
+}
+
+const std::complex<float>* SpectrumHistory::Spectrum(
+    const unsigned int age) const {
+  return &spectra_[Slot(age) * spectrum_length_];
+}
+
+const float* SpectrumHistory::Magnitudes(const unsigned int age) const {
+  return &magnitudes_[Slot(age) * spectrum_length_];
+}
+
+const float* SpectrumHistory::LogMagnitudes(const unsigned int age) const {
+  return &log_magnitudes_[Slot(age) * spectrum_length_];
+}
+
+void SpectrumHistory::Activate(void) {
+  is_active_ = true;
+}
+
+bool SpectrumHistory::IsActive(void) const {
+  return is_active_;
+}
+
+unsigned int SpectrumHistory::SpectrumLength(void) const {
+  return spectrum_length_;
+}
+
+unsigned int SpectrumHistory::Count(void) const {
+  return count_;
+}
+
+void SpectrumHistory::Reset(void) {
+  latest_slot_ = 0;
+  count_ = 0;
+  is_active_ = false;
+  std::fill(spectra_.begin(), spectra_.end(), std::complex<float>(0.0f));
+  std::fill(magnitudes_.begin(), magnitudes_.end(), 0.0f);
+  std::fill(log_magnitudes_.begin(), log_magnitudes_.end(), 0.0f);
+}
+
+void SpectrumHistory::CopyState(const SpectrumHistory& other) {
+  CHARTREUSE_ASSERT(spectrum_length_ == other.spectrum_length_);
+  CHARTREUSE_ASSERT(depth_ == other.depth_);
+  latest_slot_ = other.latest_slot_;
+  count_ = other.count_;
+  is_active_ = other.is_active_;
+  // Same lengths: no reallocation here
+  spectra_ = other.spectra_;
+  magnitudes_ = other.magnitudes_;
+  log_magnitudes_ = other.log_magnitudes_;
+}
+
+unsigned int SpectrumHistory::Slot(const unsigned int age) const {
+  CHARTREUSE_ASSERT(age > 0);
+  CHARTREUSE_ASSERT(age <= depth_);
+  return (latest_slot_ + depth_ - (age - 1)) % depth_;
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
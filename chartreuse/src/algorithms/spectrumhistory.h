@@ -0,0 +1,106 @@
+/// @file spectrumhistory.h
+/// @brief Past spectra history declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_SPECTRUMHISTORY_H_
+#define CHARTREUSE_SRC_ALGORITHMS_SPECTRUMHISTORY_H_
+
+// std::complex
+#include <complex>
+// std::vector
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief History of the past frames spectra, for stateful descriptors
+///
+/// A small ring of the last complex spectra, along with their magnitudes
+/// and log magnitudes (log(1 + magnitude)) so that these are computed
+/// only once per frame.
+///
+/// Keeping it up to date costs one spectrum computation per frame,
+/// hence it has to be activated by the descriptors which need it:
+/// until then it only holds null spectra, see Count().
+class SpectrumHistory {
+ public:
+  /// @brief Default constructor
+  ///
+  /// @param[in]  spectrum_length   Complex spectrum length
+  /// @param[in]  depth   Number of past spectra to be held
+  explicit SpectrumHistory(const unsigned int spectrum_length,
+                           const unsigned int depth);
+
+  /// @brief Push the given spectrum in the history, discarding the oldest one
+  ///
+  /// @param[in]  spectrum   Interleaved complex spectrum, of spectrum_length
+  void Push(const float* const spectrum);
+
+  /// @brief Retrieve a past complex spectrum
+  ///
+  /// @param[in]  age   How many frames ago, within [1 ; depth]
+  const std::complex<float>* Spectrum(const unsigned int age) const;
+
+  /// @brief Retrieve a past magnitude spectrum
+  ///
+  /// @param[in]  age   How many frames ago, within [1 ; depth]
+  const float* Magnitudes(const unsigned int age) const;
+
+  /// @brief Retrieve a past log magnitude spectrum
+  ///
+  /// @param[in]  age   How many frames ago, within [1 ; depth]
+  const float* LogMagnitudes(const unsigned int age) const;
+
+  /// @brief Start keeping track of the past spectra
+  void Activate(void);
+
+  /// @brief Check if the history has to be kept up to date
+  bool IsActive(void) const;
+
+  /// @brief Complex spectrum length
+  unsigned int SpectrumLength(void) const;
+
+  /// @brief Number of actual spectra pushed since the last reset,
+  /// saturating at depth: older ages only hold null spectra
+  unsigned int Count(void) const;
+
+  /// @brief Forget all past spectra, and stop keeping track of them
+  void Reset(void);
+
+  /// @brief Copy the given history state, built with the same dimensions
+  void CopyState(const SpectrumHistory& other);
+
+ private:
+  /// @brief Retrieve the ring slot holding the given age data
+  unsigned int Slot(const unsigned int age) const;
+
+  const unsigned int spectrum_length_;
+  const unsigned int depth_;
+  unsigned int latest_slot_;  ///< Slot of the last pushed spectrum
+  unsigned int count_;  ///< Pushed spectra count, at most depth_
+  bool is_active_;
+  std::vector<std::complex<float> > spectra_;  ///< All slots, contiguous
+  std::vector<float> magnitudes_;  ///< All slots, contiguous
+  std::vector<float> log_magnitudes_;  ///< All slots, contiguous
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_SPECTRUMHISTORY_H_
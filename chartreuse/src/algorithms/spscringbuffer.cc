@@ -0,0 +1,90 @@
+/// @file spscringbuffer.cc
+/// @brief Lock-free single producer single consumer ringbuffer implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/spscringbuffer.h"
+
+// std::copy_n, std::min
+#include <algorithm>
+
+namespace chartreuse {
+namespace algorithms {
+
+SpscRingBuffer::SpscRingBuffer(const std::size_t capacity)
+    : data_(capacity, 0.0f),
+      write_count_(0),
+      read_count_(0) {
+  CHARTREUSE_ASSERT(capacity > 0);
+}
+
+SpscRingBuffer::~SpscRingBuffer() {
+  // Nothing to do here for now
+}
+
+bool SpscRingBuffer::Push(const float* const src, const std::size_t count) {
+  CHARTREUSE_ASSERT(src != nullptr);
+
+  const std::size_t kWriteCount(write_count_.load(std::memory_order_relaxed));
+  // Acquire: the consumer is done with the elements it popped
+  const std::size_t kReadCount(read_count_.load(std::memory_order_acquire));
+  if (count > Capacity() - (kWriteCount - kReadCount)) {
+    return false;
+  }
+  const std::size_t kWritingPosition(kWriteCount % Capacity());
+  // Length of the "right" part: from writing cursor to the buffer end
+  const std::size_t right_part_size(std::min(Capacity() - kWritingPosition,
+                                             count));
+  std::copy_n(&src[0], right_part_size, &data_[kWritingPosition]);
+  std::copy_n(&src[right_part_size], count - right_part_size, &data_[0]);
+  // Release: elements are written before being made visible
+  write_count_.store(kWriteCount + count, std::memory_order_release);
+  return true;
+}
+
+bool SpscRingBuffer::Pop(float* const dest, const std::size_t count) {
+  CHARTREUSE_ASSERT(dest != nullptr);
+
+  const std::size_t kReadCount(read_count_.load(std::memory_order_relaxed));
+  // Acquire: the elements pushed by the producer are visible
+  const std::size_t kWriteCount(write_count_.load(std::memory_order_acquire));
+  if (count > kWriteCount - kReadCount) {
+    return false;
+  }
+  const std::size_t kReadingPosition(kReadCount % Capacity());
+  // Length of the "right" part: from reading cursor to the buffer end
+  const std::size_t right_part_size(std::min(Capacity() - kReadingPosition,
+                                             count));
+  std::copy_n(&data_[kReadingPosition], right_part_size, &dest[0]);
+  std::copy_n(&data_[0], count - right_part_size, &dest[right_part_size]);
+  // Release: elements are read before their room is given back
+  read_count_.store(kReadCount + count, std::memory_order_release);
+  return true;
+}
+
+std::size_t SpscRingBuffer::Capacity(void) const {
+  return data_.size();
+}
+
+std::size_t SpscRingBuffer::Size(void) const {
+  const std::size_t kReadCount(read_count_.load(std::memory_order_acquire));
+  return write_count_.load(std::memory_order_acquire) - kReadCount;
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
@@ -0,0 +1,87 @@
+/// @file spscringbuffer.h
+/// @brief Lock-free single producer single consumer ringbuffer declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_SPSCRINGBUFFER_H_
+#define CHARTREUSE_SRC_ALGORITHMS_SPSCRINGBUFFER_H_
+
+// std::atomic
+#include <atomic>
+// std::vector
+#include <vector>
+
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Lock-free variant of RingBuffer, for exactly one producer thread
+/// and one consumer thread
+///
+/// All operations are wait-free: they either entirely succeed or do nothing,
+/// which is then notified by their return value (contrary to RingBuffer
+/// which asserts, running out of room being here a runtime condition).
+/// No memory is allocated after construction.
+class SpscRingBuffer {
+ public:
+  /// @brief Default constructor: the user has to provide a fixed buffer length
+  explicit SpscRingBuffer(const std::size_t capacity);
+  ~SpscRingBuffer();
+
+  /// @brief Push elements into the buffer - producer thread only
+  ///
+  /// @param[in]  src   Buffer to push
+  /// @param[in]  count   Buffer elements count
+  ///
+  /// @return False if there was not enough room for all elements
+  bool Push(const float* const src, const std::size_t count);
+
+  /// @brief Pop elements out of the buffer - consumer thread only
+  ///
+  /// @param[out] dest    Buffer to store the elements into
+  /// @param[in]  count   Elements count to retrieve
+  ///
+  /// @return False if less than count elements were available
+  bool Pop(float* const dest, const std::size_t count);
+
+  /// @brief How many elements may be pushed into the buffer
+  std::size_t Capacity(void) const;
+
+  /// @brief How many elements may be popped from the buffer
+  ///
+  /// This is only a snapshot, the other thread may change it at any time
+  std::size_t Size(void) const;
+
+ private:
+  // No assignment operator for this class
+  SpscRingBuffer& operator=(const SpscRingBuffer& right);
+  // No copy constructor for this class
+  SpscRingBuffer(const SpscRingBuffer& right);
+
+  std::vector<float> data_;  ///< Internal elements buffer
+  // Both cursors are ever-increasing elements counts,
+  // their difference being the buffer size
+  std::atomic<std::size_t> write_count_;  ///< Only written by the producer
+  std::atomic<std::size_t> read_count_;  ///< Only written by the consumer
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_SPSCRINGBUFFER_H_
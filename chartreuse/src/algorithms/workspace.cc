@@ -0,0 +1,80 @@
+/// @file workspace.cc
+/// @brief Preallocated scratch memory definitions
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/algorithms/workspace.h"
+
+// std::max
+#include <algorithm>
+
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace algorithms {
+
+Workspace::Scope::Scope(Workspace* const workspace)
+    : workspace_(workspace),
+      mark_(workspace->used_) {
+  CHARTREUSE_ASSERT(workspace != nullptr);
+}
+
+Workspace::Scope::~Scope() {
+  // Scopes are stack-like: nested ones have already been closed
+  CHARTREUSE_ASSERT(workspace_->used_ >= mark_);
+  workspace_->used_ = mark_;
+}
+
+float* Workspace::Scope::Floats(const std::size_t count) {
+  CHARTREUSE_ASSERT(count > 0);
+  const std::size_t kBlockLength(BlockLength(count));
+  CHARTREUSE_ASSERT(workspace_->used_ + kBlockLength
+                    <= workspace_->data_.size());
+  float* const block(&workspace_->data_[workspace_->used_]);
+  workspace_->used_ += kBlockLength;
+  workspace_->peak_ = std::max(workspace_->peak_, workspace_->used_);
+  return block;
+}
+
+Workspace::Workspace(const std::size_t capacity)
+    : data_(capacity, 0.0f),
+      used_(0),
+      peak_(0) {
+  CHARTREUSE_ASSERT(capacity > 0);
+}
+
+std::size_t Workspace::Capacity(void) const {
+  return data_.size();
+}
+
+std::size_t Workspace::Used(void) const {
+  return used_;
+}
+
+std::size_t Workspace::Peak(void) const {
+  return peak_;
+}
+
+std::size_t Workspace::BlockLength(const std::size_t count) {
+  // Rounding up so that the next block keeps the same alignment
+  return ((count + kWorkspaceAlignment - 1) / kWorkspaceAlignment)
+         * kWorkspaceAlignment;
+}
+
+}  // namespace algorithms
+}  // namespace chartreuse
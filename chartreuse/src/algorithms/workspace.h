@@ -0,0 +1,103 @@
+/// @file workspace.h
+/// @brief Preallocated scratch memory declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_ALGORITHMS_WORKSPACE_H_
+#define CHARTREUSE_SRC_ALGORITHMS_WORKSPACE_H_
+
+// std::size_t
+#include <cstddef>
+// std::vector
+#include <vector>
+
+namespace chartreuse {
+namespace algorithms {
+
+/// @brief Borrowed blocks granularity, in floats (16 bytes)
+static const std::size_t kWorkspaceAlignment(4);
+
+/// @brief Preallocated scratch memory shared by all descriptors of a manager
+///
+/// Temporary buffers are borrowed from a single linear arena,
+/// allocated once at construction: processing never allocates.
+/// Borrowing is stack-like, through a Scope giving everything back
+/// on destruction - hence nested scopes (e.g. a descriptor retrieving
+/// another one which borrows memory itself) are fine.
+///
+/// Borrowed memory content is unspecified, and is not to be kept across
+/// processing calls.
+class Workspace {
+ public:
+  /// @brief Borrowing scope: all memory borrowed through it is given back
+  /// to the workspace on destruction
+  class Scope {
+   public:
+    explicit Scope(Workspace* const workspace);
+    ~Scope();
+
+    /// @brief Borrow a block of the given floats count
+    float* Floats(const std::size_t count);
+
+    /// @brief Borrow a block of the given elements count,
+    /// elements being made of floats (e.g. complex data)
+    template <typename Type>
+    Type* Borrow(const std::size_t count) {
+      static_assert(sizeof(Type) % sizeof(float) == 0,
+                    "Borrowed elements have to be made of floats");
+      return reinterpret_cast<Type*>(
+        Floats(count * (sizeof(Type) / sizeof(float))));
+    }
+
+   private:
+    // No copy or assignment operator for this class
+    Scope(const Scope& right);
+    Scope& operator=(const Scope& right);
+
+    Workspace* const workspace_;
+    const std::size_t mark_;  ///< Workspace usage when the scope was opened
+  };
+
+  /// @brief Default constructor
+  ///
+  /// @param[in]  capacity   Total scratch memory to be preallocated, in floats
+  explicit Workspace(const std::size_t capacity);
+
+  /// @brief Total scratch memory, in floats
+  std::size_t Capacity(void) const;
+
+  /// @brief Currently borrowed scratch memory, in floats
+  std::size_t Used(void) const;
+
+  /// @brief Highest borrowed scratch memory so far, in floats
+  std::size_t Peak(void) const;
+
+  /// @brief Actual memory taken by borrowing the given floats count,
+  /// e.g. rounded up to the blocks granularity
+  static std::size_t BlockLength(const std::size_t count);
+
+ private:
+  std::vector<float> data_;
+  std::size_t used_;
+  std::size_t peak_;  ///< Highest usage so far
+};
+
+}  // namespace algorithms
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_ALGORITHMS_WORKSPACE_H_
@@ -63,4 +63,11 @@
   #endif
 #endif
 
+/// @brief Heap allocations tracking, testing purpose only
+#if defined(_TRACK_ALLOCATIONS)
+  #define _USE_ALLOCATION_TRACKING 1
+#else
+  #define _USE_ALLOCATION_TRACKING 0
+#endif
+
 #endif  // CHARTREUSE_SRC_CONFIGURATION_H_
@@ -20,6 +20,8 @@
 
 #include "chartreuse/src/descriptors/audiofundamentalfrequency.h"
 
+// std::max, std::min, std::min_element
+#include <algorithm>
 // std::floor
 #include <cmath>
 
@@ -37,11 +39,21 @@ AudioFundamentalFrequency::AudioFundamentalFrequency(interface::Manager* manager
 }
 
 void AudioFundamentalFrequency::operator()(float* const output) {
-  // Retrieve current frame autocorrelation
-  Process(manager_->GetDescriptor(interface::DescriptorId::kAutoCorrelation),
-          manager_->AnalysisParameters().min_lag,
-          manager_->AnalysisParameters().max_lag,
-          output);
+  const interface::Manager::Parameters& parameters(
+    manager_->AnalysisParameters());
+  if (parameters.pitch_estimator == interface::PitchEstimator::kYin) {
+    ProcessDifference(
+      manager_->GetDescriptor(interface::DescriptorId::kNormalizedDifference),
+      parameters.min_lag,
+      parameters.max_lag,
+      output);
+  } else {
+    // Retrieve current frame autocorrelation
+    Process(manager_->GetDescriptor(interface::DescriptorId::kAutoCorrelation),
+            parameters.min_lag,
+            parameters.max_lag,
+            output);
+  }
 }
 
 void AudioFundamentalFrequency::Process(const float* const autocorrelation,
@@ -66,6 +78,50 @@ void AudioFundamentalFrequency::Process(const float* const autocorrelation,
   output[0] = static_cast<float>(min_lag) + std::floor(argmin);
 }
 
+void AudioFundamentalFrequency::ProcessDifference(
+    const float* const normalized_difference,
+    const unsigned int min_lag,
+    const unsigned int max_lag,
+    float* const output) {
+  CHARTREUSE_ASSERT(normalized_difference != nullptr);
+  CHARTREUSE_ASSERT(min_lag > 0);
+  CHARTREUSE_ASSERT(max_lag > 0);
+  CHARTREUSE_ASSERT(max_lag > min_lag);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(output != normalized_difference);
+
+  const unsigned int kDataLength(max_lag - min_lag);
+  unsigned int dip(0);
+  while ((dip < kDataLength) && (normalized_difference[dip] >= kYinThreshold)) {
+    dip += 1;
+  }
+  if (dip < kDataLength) {
+    // Going down to the bottom of the dip
+    while ((dip + 1 < kDataLength)
+           && (normalized_difference[dip + 1] < normalized_difference[dip])) {
+      dip += 1;
+    }
+  } else {
+    dip = static_cast<unsigned int>(
+      std::min_element(&normalized_difference[0],
+                       &normalized_difference[kDataLength])
+      - &normalized_difference[0]);
+  }
+  float offset(0.0f);
+  if ((dip > 0) && (dip + 1 < kDataLength)) {
+    const float kPrev(normalized_difference[dip - 1]);
+    const float kCurrent(normalized_difference[dip]);
+    const float kNext(normalized_difference[dip + 1]);
+    const float kCurvature(kPrev - 2.0f * kCurrent + kNext);
+    if (kCurvature > 0.0f) {
+      offset = 0.5f * (kPrev - kNext) / kCurvature;
+    }
+  }
+  output[0] = std::min(static_cast<float>(max_lag),
+                       std::max(static_cast<float>(min_lag),
+                                static_cast<float>(min_lag + dip) + offset));
+}
+
 Descriptor_Meta AudioFundamentalFrequency::Meta(void) const {
   return Descriptor_Meta(
     1,
@@ -73,5 +129,13 @@ Descriptor_Meta AudioFundamentalFrequency::Meta(void) const {
     static_cast<float>(manager_->AnalysisParameters().max_lag));
 }
 
+bool AudioFundamentalFrequency::IsGated(void) const {
+  return true;
+}
+
+void AudioFundamentalFrequency::Silence(float* const output) {
+  output[0] = 0.0f;
+}
+
 }  // namespace descriptors
 }  // namespace chartreuse
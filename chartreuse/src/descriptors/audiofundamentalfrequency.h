@@ -26,7 +26,13 @@
 namespace chartreuse {
 namespace descriptors {
 
+/// @brief Absolute threshold on the normalized difference for the YIN method
+static const float kYinThreshold(0.1f);
+
 /// @brief AudioFundamentalFrequency descriptor: retrieve each frame estimated f0
+///
+/// The estimation method is given by the manager parameters,
+/// the output being the estimated period (in samples) for all of them.
 class AudioFundamentalFrequency : public Descriptor_Interface {
  public:
   explicit AudioFundamentalFrequency(interface::Manager* manager);
@@ -40,8 +46,28 @@ class AudioFundamentalFrequency : public Descriptor_Interface {
                const unsigned int max_lag,
                float* const output);
 
+  /// @brief Same as above, for the YIN method
+  ///
+  /// The first dip below kYinThreshold is selected (the global minimum
+  /// if there is none), and refined by parabolic interpolation.
+  ///
+  /// @param[in]  normalized_difference   CMNDF of lags [min_lag ; max_lag[
+  /// @param[in]  min_lag   Smaller lag
+  /// @param[in]  max_lag   Higher lag (excluded)
+  /// @param[out]  output   Estimated period, within [min_lag ; max_lag]
+  void ProcessDifference(const float* const normalized_difference,
+                         const unsigned int min_lag,
+                         const unsigned int max_lag,
+                         float* const output);
+
   Descriptor_Meta Meta(void) const;
 
+  /// @brief Skipped on silent frames
+  bool IsGated(void) const;
+
+  /// @brief Silent frames have no period, output 0
+  void Silence(float* const output);
+
  private:
   // No assignment operator for this class
   AudioFundamentalFrequency& operator=(const AudioFundamentalFrequency& right);
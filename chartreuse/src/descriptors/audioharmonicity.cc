@@ -77,5 +77,13 @@ Descriptor_Meta AudioHarmonicity::Meta(void) const {
     1.0f);
 }
 
+bool AudioHarmonicity::IsGated(void) const {
+  return true;
+}
+
+void AudioHarmonicity::Silence(float* const output) {
+  output[0] = 0.0f;
+}
+
 }  // namespace descriptors
 }  // namespace chartreuse
@@ -42,6 +42,12 @@ class AudioHarmonicity : public Descriptor_Interface {
 
   Descriptor_Meta Meta(void) const;
 
+  /// @brief Skipped on silent frames
+  bool IsGated(void) const;
+
+  /// @brief Silent frames are unvoiced, output 0
+  void Silence(float* const output);
+
  private:
   // No assignment operator for this class
   AudioHarmonicity& operator=(const AudioHarmonicity& right);
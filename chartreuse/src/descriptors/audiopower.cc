@@ -51,6 +51,34 @@ void AudioPower::Process(const float* const input,
     * kNormFactor;
 }
 
+void AudioPower::Process(const float* const input,
+                         const std::size_t input_length,
+                         const std::size_t frames_count,
+                         const std::size_t frame_stride,
+                         const std::size_t output_stride,
+                         float* const output) {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(input_length > 0);
+  CHARTREUSE_ASSERT(frames_count > 0);
+  CHARTREUSE_ASSERT(frame_stride > 0);
+  CHARTREUSE_ASSERT(output_stride > 0);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(input != output);
+
+  // One column per frame
+  const Eigen::Map<const Eigen::MatrixXf, 0, Eigen::OuterStride<> > frames(
+    input,
+    input_length,
+    frames_count,
+    Eigen::OuterStride<>(frame_stride));
+  const float kNormFactor(1 / static_cast<float>(input_length));
+  Eigen::Map<Eigen::RowVectorXf, 0, Eigen::InnerStride<> > powers(
+    output,
+    frames_count,
+    Eigen::InnerStride<>(output_stride));
+  powers = frames.colwise().squaredNorm() * kNormFactor;
+}
+
 Descriptor_Meta AudioPower::Meta(void) const {
   return Descriptor_Meta(1, 0.0f, 1.0f);
 }
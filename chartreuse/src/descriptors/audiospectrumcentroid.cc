@@ -20,12 +20,10 @@
 
 #include "chartreuse/src/descriptors/audiospectrumcentroid.h"
 
-// std::ceil, std::log
-#include <cmath>
+#include <array>
 
-#include "Eigen/Core"
-
-#include "chartreuse/src/algorithms/algorithms_common.h"
+#include "chartreuse/src/algorithms/spectralmoments.h"
+#include "chartreuse/src/interface/analysiscontext.h"
 #include "chartreuse/src/interface/manager.h"
 
 namespace chartreuse {
@@ -33,17 +31,15 @@ namespace descriptors {
 
 AudioSpectrumCentroid::AudioSpectrumCentroid(interface::Manager* manager)
     : Descriptor_Interface(manager),
-      // TODO(gm): remove this magic
-      normalization_factor_(manager->AnalysisParameters().dft_length * 571.865f) {
+      normalization_factor_(manager->Context().SpectrumNormalization()) {
   // Nothing to do here for now
 }
 
 void AudioSpectrumCentroid::operator()(float* const output) {
-  Process(manager_->GetDescriptor(interface::DescriptorId::kSpectrogramPower),
-          output,
-          manager_->FrequencyScale(),
-          manager_->AnalysisParameters().low_edge,
-          manager_->AnalysisParameters().high_edge);
+  // Retrieve the moments computed in a single pass over the spectrum
+  const float* const moments(manager_->GetDescriptor(
+    interface::DescriptorId::kSpectralMoments));
+  output[0] = moments[algorithms::SpectralMoment::kCentroid];
 }
 
 void AudioSpectrumCentroid::Process(const float* const spectrogram_power,
@@ -60,36 +56,23 @@ void AudioSpectrumCentroid::Process(const float* const spectrogram_power,
   CHARTREUSE_ASSERT(high_edge_idx > 0);
   CHARTREUSE_ASSERT(high_edge_idx > low_edge_idx);
 
-  // Get the normalized squared magnitude spectrogram of the frame
-  Eigen::Array<float, Eigen::Dynamic, 1> power(
-    Eigen::Map<const Eigen::Array<float, Eigen::Dynamic, 1>>(spectrogram_power,
-                                                             high_edge_idx));
-  // The DC component is unchanged, everything else is doubled
-  power[0] *= 0.5f;
-  power *= 2.0f / normalization_factor_;
-  // Summing the contributions of all frequencies lower than 62.5
-  for (unsigned int i(0); i < low_edge_idx - 1; ++i) {
-    power[low_edge_idx - 1] += power[i];
-  }
-  const float kPowerSum(power.tail(high_edge_idx - low_edge_idx + 1).sum()
-    // Prevent divide by zero
-    + 1e-7f);
-  CHARTREUSE_ASSERT(kPowerSum > 0.0f);
-  // Weight each DFT bin by the log of the frequency relative to 1000Hz
-  // The first bin is the low edge
-  const Eigen::Array<float, Eigen::Dynamic, 1> FreqScale(Eigen::Map<const Eigen::Array<float, Eigen::Dynamic, 1>>(frequency_scale,
-    high_edge_idx - low_edge_idx + 1));
-  const float kOut(power.tail(high_edge_idx - low_edge_idx + 1).cwiseProduct(FreqScale).sum());
-  //float kOut(power_[kLowEdgeIndex_ - 1] * -5.0f);
-  //for (unsigned int i(kLowEdgeIndex_); i < kHighEdgeIndex_; ++i) {
-  //  kOut += power_[i] * freq_scale_.Data()[i - kLowEdgeIndex_];
-  //}
-  output[0] = kOut / kPowerSum;
+  std::array<float, algorithms::SpectralMoment::kCount> moments;
+  algorithms::ComputeSpectralMoments(spectrogram_power,
+                                     frequency_scale,
+                                     low_edge_idx,
+                                     high_edge_idx,
+                                     normalization_factor_,
+                                     &moments[0]);
+  output[0] = moments[algorithms::SpectralMoment::kCentroid];
 }
 
 Descriptor_Meta AudioSpectrumCentroid::Meta(void) const {
   return Descriptor_Meta(1, -5.0f, 5.0f);
 }
 
+bool AudioSpectrumCentroid::IsGated(void) const {
+  return true;
+}
+
 }  // namespace descriptors
 }  // namespace chartreuse
@@ -43,6 +43,9 @@ class AudioSpectrumCentroid : public Descriptor_Interface {
 
   Descriptor_Meta Meta(void) const;
 
+  /// @brief Skipped on silent frames, the previous value being held
+  bool IsGated(void) const;
+
  private:
   // No assignment operator for this class
   AudioSpectrumCentroid& operator=(const AudioSpectrumCentroid& right);
@@ -0,0 +1,66 @@
+/// @file audiospectrumenvelope.h
+/// @brief AudioSpectrumEnvelope descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_AUDIOSPECTRUMENVELOPE_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_AUDIOSPECTRUMENVELOPE_H_
+
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+
+// Internal forward declaration
+namespace algorithms {
+class OctaveBands;
+}  // namespace algorithms
+
+namespace descriptors {
+
+/// @brief Lower edge of the logarithmic bands (MPEG-7 default)
+static const float kEnvelopeLowEdge(62.5f);
+/// @brief Higher edge of the logarithmic bands (MPEG-7 default)
+static const float kEnvelopeHighEdge(16000.0f);
+
+/// @brief AudioSpectrumEnvelope descriptor: for each frame, retrieve the
+/// spectrum power within logarithmic bands of the analysis octave resolution,
+/// plus the power below and above these bands
+class AudioSpectrumEnvelope : public Descriptor_Interface {
+ public:
+  explicit AudioSpectrumEnvelope(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const spectrogram_power,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+ private:
+  // No assignment operator for this class
+  AudioSpectrumEnvelope& operator=(const AudioSpectrumEnvelope& right);
+
+  const algorithms::OctaveBands& bands_;
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_AUDIOSPECTRUMENVELOPE_H_
@@ -0,0 +1,55 @@
+/// @file audiospectrumflatness.cc
+/// @brief AudioSpectrumFlatness descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/audiospectrumflatness.h"
+
+#include "chartreuse/src/algorithms/spectralflatness.h"
+#include "chartreuse/src/interface/analysiscontext.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+AudioSpectrumFlatness::AudioSpectrumFlatness(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      bands_(manager->Context().SpectrumFlatnessBands()) {
+  // Nothing to do here for now
+}
+
+void AudioSpectrumFlatness::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kSpectrogramPower),
+          output);
+}
+
+void AudioSpectrumFlatness::Process(const float* const spectrogram_power,
+                                    float* const output) {
+  CHARTREUSE_ASSERT(spectrogram_power != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrogram_power != output);
+
+  bands_.Process(spectrogram_power, output);
+}
+
+Descriptor_Meta AudioSpectrumFlatness::Meta(void) const {
+  return Descriptor_Meta(bands_.BandsCount(), 0.0f, 1.0f);
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
@@ -0,0 +1,72 @@
+/// @file audiospectrumflatness.h
+/// @brief AudioSpectrumFlatness descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_AUDIOSPECTRUMFLATNESS_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_AUDIOSPECTRUMFLATNESS_H_
+
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+
+// Internal forward declaration
+namespace algorithms {
+class FlatnessBands;
+}  // namespace algorithms
+
+namespace descriptors {
+
+/// @brief Lower nominal edge of the bands (MPEG-7 default)
+static const float kFlatnessLowEdge(250.0f);
+/// @brief Higher nominal edge of the bands (MPEG-7 default)
+static const float kFlatnessHighEdge(16000.0f);
+/// @brief Bands width, in octaves (MPEG-7 quarter octave)
+static const float kFlatnessResolution(0.25f);
+/// @brief Bands relative extension on both sides (MPEG-7 5% overlap)
+static const float kFlatnessOverlap(0.05f);
+/// @brief Minimum bin power, preventing log(0) on silent frames
+static const float kFlatnessPowerFloor(1e-10f);
+
+/// @brief AudioSpectrumFlatness descriptor: for each frame, retrieve the
+/// flatness of the spectrum (ratio between its geometric and arithmetic means)
+/// within quarter octave bands
+class AudioSpectrumFlatness : public Descriptor_Interface {
+ public:
+  explicit AudioSpectrumFlatness(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const spectrogram_power,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+ private:
+  // No assignment operator for this class
+  AudioSpectrumFlatness& operator=(const AudioSpectrumFlatness& right);
+
+  const algorithms::FlatnessBands& bands_;
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_AUDIOSPECTRUMFLATNESS_H_
@@ -0,0 +1,78 @@
+/// @file audiospectrumkurtosis.cc
+/// @brief AudioSpectrumKurtosis descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/audiospectrumkurtosis.h"
+
+#include <array>
+
+#include "chartreuse/src/algorithms/spectralmoments.h"
+#include "chartreuse/src/interface/analysiscontext.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+AudioSpectrumKurtosis::AudioSpectrumKurtosis(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      normalization_factor_(manager->Context().SpectrumNormalization()) {
+  // Nothing to do here for now
+}
+
+void AudioSpectrumKurtosis::operator()(float* const output) {
+  // Retrieve the moments computed in a single pass over the spectrum
+  const float* const moments(manager_->GetDescriptor(
+    interface::DescriptorId::kSpectralMoments));
+  output[0] = moments[algorithms::SpectralMoment::kKurtosis];
+}
+
+void AudioSpectrumKurtosis::Process(const float* const spectrogram_power,
+                                  float* const output,
+                                  const float* const frequency_scale,
+                                  const unsigned int low_edge_idx,
+                                  const unsigned int high_edge_idx) {
+  CHARTREUSE_ASSERT(spectrogram_power != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrogram_power != output);
+  CHARTREUSE_ASSERT(spectrogram_power != frequency_scale);
+  CHARTREUSE_ASSERT(frequency_scale != nullptr);
+  CHARTREUSE_ASSERT(low_edge_idx > 0);
+  CHARTREUSE_ASSERT(high_edge_idx > 0);
+  CHARTREUSE_ASSERT(high_edge_idx > low_edge_idx);
+
+  std::array<float, algorithms::SpectralMoment::kCount> moments;
+  algorithms::ComputeSpectralMoments(spectrogram_power,
+                                     frequency_scale,
+                                     low_edge_idx,
+                                     high_edge_idx,
+                                     normalization_factor_,
+                                     &moments[0]);
+  output[0] = moments[algorithms::SpectralMoment::kKurtosis];
+}
+
+Descriptor_Meta AudioSpectrumKurtosis::Meta(void) const {
+  return Descriptor_Meta(1, 0.0f, algorithms::kMaxKurtosis);
+}
+
+bool AudioSpectrumKurtosis::IsGated(void) const {
+  return true;
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
@@ -20,12 +20,10 @@
 
 #include "chartreuse/src/descriptors/audiospectrumspread.h"
 
-// std::ceil, std::log
-#include <cmath>
+#include <array>
 
-#include "Eigen/Core"
-
-#include "chartreuse/src/algorithms/algorithms_common.h"
+#include "chartreuse/src/algorithms/spectralmoments.h"
+#include "chartreuse/src/interface/analysiscontext.h"
 #include "chartreuse/src/interface/manager.h"
 
 namespace chartreuse {
@@ -33,17 +31,15 @@ namespace descriptors {
 
 AudioSpectrumSpread::AudioSpectrumSpread(interface::Manager* manager)
     : Descriptor_Interface(manager),
-      // TODO(gm): remove this magic
-      normalization_factor_(manager->AnalysisParameters().dft_length * 571.865f) {
+      normalization_factor_(manager->Context().SpectrumNormalization()) {
   // Nothing to do here for now
 }
 
 void AudioSpectrumSpread::operator()(float* const output) {
-  Process(manager_->GetDescriptor(interface::DescriptorId::kSpectrogramPower),
-          output,
-          manager_->FrequencyScale(),
-          manager_->AnalysisParameters().low_edge,
-          manager_->AnalysisParameters().high_edge);
+  // Retrieve the moments computed in a single pass over the spectrum
+  const float* const moments(manager_->GetDescriptor(
+    interface::DescriptorId::kSpectralMoments));
+  output[0] = moments[algorithms::SpectralMoment::kSpread];
 }
 
 void AudioSpectrumSpread::Process(const float* const spectrogram_power,
@@ -60,35 +56,23 @@ void AudioSpectrumSpread::Process(const float* const spectrogram_power,
   CHARTREUSE_ASSERT(high_edge_idx > 0);
   CHARTREUSE_ASSERT(high_edge_idx > low_edge_idx);
 
-  // Get the centroid of the frame
-  const float kCentroid(*manager_->GetDescriptor(
-    interface::DescriptorId::kAudioSpectrumCentroid));
-
-  // Get the normalized squared magnitude spectrogram of the frame
-  Eigen::Array<float, Eigen::Dynamic, 1> power(
-    Eigen::Map<const Eigen::Array<float, Eigen::Dynamic, 1>>(spectrogram_power,
-                                                             high_edge_idx));
-  // The DC component is unchanged, everything else is doubled
-  power[0] *= 0.5f;
-  power *= 2.0f / normalization_factor_;
-  // Summing the contributions of all frequencies lower than 62.5
-  for (unsigned int i(0); i < low_edge_idx - 1; ++i) {
-    power[low_edge_idx - 1] += power[i];
-  }
-  const float kPowerSum(power.tail(high_edge_idx - low_edge_idx + 1).sum()
-    // Prevent divide by zero
-    + 1e-7f);
-  CHARTREUSE_ASSERT(kPowerSum > 0.0f);
-  const Eigen::Array<float, Eigen::Dynamic, 1> FreqScale(Eigen::Map<const Eigen::Array<float, Eigen::Dynamic, 1>>(frequency_scale,
-    high_edge_idx - low_edge_idx + 1));
-  const Eigen::Array<float, Eigen::Dynamic, 1> tmp(FreqScale - kCentroid);
-  const float kOut(power.tail(high_edge_idx - low_edge_idx + 1).cwiseProduct(tmp.cwiseAbs2()).sum());
-  output[0] = std::sqrt(kOut / kPowerSum);
+  std::array<float, algorithms::SpectralMoment::kCount> moments;
+  algorithms::ComputeSpectralMoments(spectrogram_power,
+                                     frequency_scale,
+                                     low_edge_idx,
+                                     high_edge_idx,
+                                     normalization_factor_,
+                                     &moments[0]);
+  output[0] = moments[algorithms::SpectralMoment::kSpread];
 }
 
 Descriptor_Meta AudioSpectrumSpread::Meta(void) const {
   return Descriptor_Meta(1, 0.0f, 4.0f);
 }
 
+bool AudioSpectrumSpread::IsGated(void) const {
+  return true;
+}
+
 }  // namespace descriptors
 }  // namespace chartreuse
@@ -20,35 +20,173 @@
 
 #include "chartreuse/src/descriptors/audioupperlimitofharmonicity.h"
 
+// std::copy, std::fill, std::min
+#include <algorithm>
+#include <complex>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/algorithms/apodizer.h"
+#include "chartreuse/src/algorithms/combedsignalgenerator.h"
+#include "chartreuse/src/algorithms/kissfft.h"
+#include "chartreuse/src/algorithms/workspace.h"
+#include "chartreuse/src/interface/analysiscontext.h"
 #include "chartreuse/src/interface/manager.h"
 
 namespace chartreuse {
 namespace descriptors {
 
+/// @brief Snap the given frequency to the nearest octave
+/// (arithmetic mean of the surrounding ones as threshold)
+static float SnapToOctave(const float frequency) {
+  float lower(kMinUpperLimitOfHarmonicity);
+  if (frequency <= lower) {
+    return lower;
+  }
+  while (lower < kMaxUpperLimitOfHarmonicity) {
+    const float kUpper(2.0f * lower);
+    if (frequency <= kUpper) {
+      return (frequency < 1.5f * lower) ? lower : kUpper;
+    }
+    lower = kUpper;
+  }
+  return kMaxUpperLimitOfHarmonicity;
+}
+
+/// @brief Window, zero-pad and transform the given frame in-place,
+/// then compute its power spectrum
+///
+/// @param[in]  apodizer   Window to apply, of the frame length
+/// @param[in]  plan   Transform plan
+/// @param[in]  frame_length   Actual frame data length
+/// @param[in,out]  frame   Frame to transform (of dft_length + 2)
+/// @param[in]  scratch   Transform scratch buffer
+/// @param[out]  transformed   Frame transform (of dft_length + 2)
+/// @param[out]  power   Frame power spectrum (of dft_length / 2 + 1)
+static void PowerSpectrum(const algorithms::Apodizer& apodizer,
+                          const algorithms::KissFFTPlan& plan,
+                          const std::size_t frame_length,
+                          float* const frame,
+                          kiss_fft_cpx* const scratch,
+                          float* const transformed,
+                          float* const power) {
+  const unsigned int kSpectrumLength(plan.Length() / 2 + 1);
+  apodizer.ApplyWindow(&frame[0]);
+  std::fill(&frame[frame_length], &frame[plan.Length() + 2], 0.0f);
+  plan.Process(&frame[0], &scratch[0], &transformed[0]);
+  Eigen::Map<Eigen::VectorXf>(&power[0], kSpectrumLength)
+    = Eigen::Map<const Eigen::VectorXcf>(
+        reinterpret_cast<const std::complex<float>*>(&transformed[0]),
+        kSpectrumLength).cwiseAbs2();
+}
+
+unsigned int UpperLimitOfHarmonicityBin(const float* const signal_power,
+                                        const float* const residual_power,
+                                        const unsigned int spectrum_length) {
+  CHARTREUSE_ASSERT(signal_power != nullptr);
+  CHARTREUSE_ASSERT(residual_power != nullptr);
+  CHARTREUSE_ASSERT(spectrum_length > 1);
+
+  // Both powers of all bins strictly above the current one
+  float signal_sum(0.0f);
+  float residual_sum(0.0f);
+  for (unsigned int bin(spectrum_length - 1); bin > 0; --bin) {
+    if (bin + 1 < spectrum_length) {
+      signal_sum += signal_power[bin + 1];
+      residual_sum += residual_power[bin + 1];
+    }
+    if ((signal_sum > 0.0f) && (residual_sum < 0.5f * signal_sum)) {
+      return bin;
+    }
+  }
+  return 0;
+}
+
 AudioUpperLimitOfHarmonicity::AudioUpperLimitOfHarmonicity(interface::Manager* manager)
-    : Descriptor_Interface(manager) {
+    : Descriptor_Interface(manager),
+      apodizer_(manager->Context().FrameWindow()),
+      plan_(manager->Context().DftPlan()),
+      sampling_freq_(manager->AnalysisParameters().sampling_freq) {
   // Nothing to do here for now
 }
 
 void AudioUpperLimitOfHarmonicity::operator()(float* const output) {
-  IGNORE(output);
+  const float kAFF(*manager_->GetDescriptor(
+    interface::DescriptorId::kAudioFundamentalFrequency));
+  Process(manager_->CurrentWindow(),
+          manager_->AnalysisParameters().window_length,
+          manager_->AnalysisParameters().hop_size_sample,
+          kAFF,
+          output);
 }
 
-void AudioUpperLimitOfHarmonicity::Process(const float* const autocorrelation,
+void AudioUpperLimitOfHarmonicity::Process(const float* const window,
+                                           const std::size_t window_length,
+                                           const std::size_t frame_length,
                                            const float estimated_lag,
-                                           const unsigned int min_lag,
                                            float* const output) {
-  IGNORE(autocorrelation);
-  IGNORE(estimated_lag);
-  IGNORE(min_lag);
-  IGNORE(output);
+  CHARTREUSE_ASSERT(window != nullptr);
+  CHARTREUSE_ASSERT(window_length > frame_length);
+  CHARTREUSE_ASSERT(frame_length > 0);
+  // The frame window is of the hop size
+  CHARTREUSE_ASSERT(frame_length
+                    == manager_->AnalysisParameters().hop_size_sample);
+  CHARTREUSE_ASSERT(frame_length <= plan_.Length());
+  CHARTREUSE_ASSERT(estimated_lag >= 1.0f);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(window != output);
+
+  const unsigned int kLag(std::min(static_cast<unsigned int>(estimated_lag),
+    static_cast<unsigned int>(window_length - frame_length)));
+  const unsigned int kDftLength(plan_.Length());
+  const unsigned int kSpectrumLength(kDftLength / 2 + 1);
+  algorithms::Workspace::Scope scope(&manager_->Scratch());
+  float* const windowed(scope.Floats(kDftLength + 2));
+  kiss_fft_cpx* const scratch(
+    scope.Borrow<kiss_fft_cpx>(plan_.ScratchLength()));
+  float* const transformed(scope.Floats(kDftLength + 2));
+  float* const signal_power(scope.Floats(kSpectrumLength));
+  float* const residual_power(scope.Floats(kSpectrumLength));
+
+  // Both the current frame (at the window end) and its combed version
+  // go through the same window and the same zero-padded transform
+  std::copy(&window[window_length - frame_length],
+            &window[window_length],
+            &windowed[0]);
+  PowerSpectrum(apodizer_,
+                plan_,
+                frame_length,
+                &windowed[0],
+                &scratch[0],
+                &transformed[0],
+                &signal_power[0]);
+  algorithms::CombedSignalGenerator generator(
+    static_cast<unsigned int>(window_length),
+    kLag);
+  generator(window, frame_length, &windowed[0]);
+  PowerSpectrum(apodizer_,
+                plan_,
+                frame_length,
+                &windowed[0],
+                &scratch[0],
+                &transformed[0],
+                &residual_power[0]);
+
+  const unsigned int kBin(UpperLimitOfHarmonicityBin(&signal_power[0],
+                                                     &residual_power[0],
+                                                     kSpectrumLength));
+  output[0] = SnapToOctave(kBin * sampling_freq_ / kDftLength);
 }
 
 Descriptor_Meta AudioUpperLimitOfHarmonicity::Meta(void) const {
   return Descriptor_Meta(
     1,
-    -1.0f,
-    1.0f);
+    kMinUpperLimitOfHarmonicity,
+    kMaxUpperLimitOfHarmonicity);
+}
+
+bool AudioUpperLimitOfHarmonicity::IsGated(void) const {
+  return true;
 }
 
 }  // namespace descriptors
@@ -24,10 +24,44 @@
 #include "chartreuse/src/descriptors/descriptor_interface.h"
 
 namespace chartreuse {
+
+// Internal forward declaration
+namespace algorithms {
+class Apodizer;
+template <typename SampleType> class BasicKissFFTPlan;
+typedef BasicKissFFTPlan<float> KissFFTPlan;
+}  // namespace algorithms
+
 namespace descriptors {
 
+/// @brief Lowest upper limit of harmonicity, in Hz
+static const float kMinUpperLimitOfHarmonicity(31.25f);
+/// @brief Highest upper limit of harmonicity, in Hz
+static const float kMaxUpperLimitOfHarmonicity(16000.0f);
+
+/// @brief Retrieve the bin after which the frame is no longer "harmonic":
+/// the highest one where the comb filter residual power above it gets lower
+/// than half of the signal power above it
+///
+/// Done in a single pass from the highest bin, accumulating both powers.
+///
+/// @param[in]  signal_power   Signal power spectrum
+/// @param[in]  residual_power   Combed signal power spectrum
+/// @param[in]  spectrum_length   Length of both spectra
+///
+/// @return upper limit bin, 0 if not found
+unsigned int UpperLimitOfHarmonicityBin(const float* const signal_power,
+                                        const float* const residual_power,
+                                        const unsigned int spectrum_length);
+
 /// @brief AudioHarmonicity "ULH" part descriptor: retrieve the value in Hz
 /// after which the frame is no longer estimated "harmonic"
+///
+/// The current frame is combed by the estimated fundamental lag,
+/// the power spectra of the residual and of the frame are then compared:
+/// both are windowed and transformed the same way.
+/// Output is snapped to the nearest octave of an octave scale
+/// centered upon 1kHz.
 class AudioUpperLimitOfHarmonicity : public Descriptor_Interface {
  public:
   explicit AudioUpperLimitOfHarmonicity(interface::Manager* manager);
@@ -36,16 +70,31 @@ class AudioUpperLimitOfHarmonicity : public Descriptor_Interface {
 
   /// @brief Independent process method: this is where the actual computation
   /// is done, to be used in a "raw" way when no manager is available
-  void Process(const float* const autocorrelation,
+  ///
+  /// @param[in]  window   Current (overlapped) data window
+  /// @param[in]  window_length   Data window length
+  /// @param[in]  frame_length   Current frame length, at the window end
+  /// (the hop size)
+  /// @param[in]  estimated_lag   Fundamental frequency lag, in samples
+  /// @param[out]  output   Upper limit of harmonicity, in Hz
+  void Process(const float* const window,
+               const std::size_t window_length,
+               const std::size_t frame_length,
                const float estimated_lag,
-               const unsigned int min_lag,
                float* const output);
 
   Descriptor_Meta Meta(void) const;
 
+  /// @brief Skipped on silent frames, the previous value being held
+  bool IsGated(void) const;
+
  private:
   // No assignment operator for this class
   AudioUpperLimitOfHarmonicity& operator=(const AudioUpperLimitOfHarmonicity& right);
+
+  const algorithms::Apodizer& apodizer_;  ///< Shared frame window
+  const algorithms::KissFFTPlan& plan_;   ///< Shared transform plan
+  const float sampling_freq_;
 };
 
 }  // namespace descriptors
@@ -50,6 +50,35 @@ void AudioWaveform::Process(const float* const input,
   output[1] = Eigen::Map<const Eigen::VectorXf>(input, input_length).maxCoeff();
 }
 
+void AudioWaveform::Process(const float* const input,
+                            const std::size_t input_length,
+                            const std::size_t frames_count,
+                            const std::size_t frame_stride,
+                            const std::size_t output_stride,
+                            float* const output) {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(input_length > 0);
+  CHARTREUSE_ASSERT(frames_count > 0);
+  CHARTREUSE_ASSERT(frame_stride > 0);
+  CHARTREUSE_ASSERT(output_stride >= 2);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(input != output);
+
+  const Eigen::Map<const Eigen::MatrixXf, 0, Eigen::OuterStride<> > frames(
+    input,
+    input_length,
+    frames_count,
+    Eigen::OuterStride<>(frame_stride));
+  // Output rows are min and max, one column per frame
+  Eigen::Map<Eigen::MatrixXf, 0, Eigen::OuterStride<> > bounds(
+    output,
+    2,
+    frames_count,
+    Eigen::OuterStride<>(output_stride));
+  bounds.row(0) = frames.colwise().minCoeff();
+  bounds.row(1) = frames.colwise().maxCoeff();
+}
+
 Descriptor_Meta AudioWaveform::Meta(void) const {
   return Descriptor_Meta(2, -1.0f, 1.0f);
 }
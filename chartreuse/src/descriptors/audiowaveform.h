@@ -39,6 +39,18 @@ class AudioWaveform : public Descriptor_Interface {
     const std::size_t input_length,
     float* const output);
 
+  /// @brief Batched process method: same as above for frames_count frames,
+  /// the i-th one starting at input[i * frame_stride]
+  ///
+  /// Output is the (min, max) pair of each frame, the i-th one starting at
+  /// output[i * output_stride] (e.g. rows of a larger output).
+  void Process(const float* const input,
+    const std::size_t input_length,
+    const std::size_t frames_count,
+    const std::size_t frame_stride,
+    const std::size_t output_stride,
+    float* const output);
+
   Descriptor_Meta Meta(void) const;
 };
 
@@ -0,0 +1,59 @@
+/// @file barkbands.cc
+/// @brief BarkBands descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/barkbands.h"
+
+#include "chartreuse/src/algorithms/filterbank.h"
+#include "chartreuse/src/interface/analysiscontext.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+BarkBands::BarkBands(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      filter_bank_(manager->Context().BarkFilterBank()) {
+  // Nothing to do here for now
+}
+
+void BarkBands::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kSpectrogramPower),
+          output);
+}
+
+void BarkBands::Process(const float* const spectrogram_power,
+                        float* const output) {
+  CHARTREUSE_ASSERT(spectrogram_power != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrogram_power != output);
+
+  filter_bank_.Apply(spectrogram_power, output);
+}
+
+Descriptor_Meta BarkBands::Meta(void) const {
+  // Filters are normalized: each band is a weighted mean of the spectrum power
+  const unsigned int kDftLength(manager_->AnalysisParameters().dft_length);
+  return Descriptor_Meta(kBarkBandsCount,
+                         0.0f,
+                         static_cast<float>(kDftLength * kDftLength));
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
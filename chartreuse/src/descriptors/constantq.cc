@@ -0,0 +1,57 @@
+/// @file constantq.cc
+/// @brief ConstantQ descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/constantq.h"
+
+#include "chartreuse/src/algorithms/constantqkernel.h"
+#include "chartreuse/src/interface/analysiscontext.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+ConstantQ::ConstantQ(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      kernel_(manager->Context().ConstantQSpectralKernel()) {
+  // Nothing to do here for now
+}
+
+void ConstantQ::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kSpectrogram),
+          output);
+}
+
+void ConstantQ::Process(const float* const spectrogram,
+                        float* const output) {
+  CHARTREUSE_ASSERT(spectrogram != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrogram != output);
+
+  kernel_.Apply(spectrogram, output);
+}
+
+Descriptor_Meta ConstantQ::Meta(void) const {
+  // Temporal kernels are normalized by their length:
+  // each bin is at most the input maximum magnitude
+  return Descriptor_Meta(kConstantQBinsCount, 0.0f, 1.0f);
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
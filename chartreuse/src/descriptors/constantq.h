@@ -0,0 +1,74 @@
+/// @file constantq.h
+/// @brief ConstantQ descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_CONSTANTQ_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_CONSTANTQ_H_
+
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+
+// Internal forward declaration
+namespace algorithms {
+class ConstantQKernel;
+}  // namespace algorithms
+
+namespace descriptors {
+
+/// @brief Center frequency of the first constant-Q bin (A2)
+static const float kConstantQMinFreq(110.0f);
+/// @brief Constant-Q frequency resolution (semitones)
+static const unsigned int kConstantQBinsPerOctave(12);
+/// @brief Number of constant-Q bins (6 octaves)
+static const unsigned int kConstantQBinsCount(72);
+/// @brief Spectral kernels coefficients relative threshold
+static const float kConstantQThreshold(0.0054f);
+
+/// @brief ConstantQ descriptor: for each frame, retrieve the magnitudes of
+/// its constant-Q transform (logarithmically spaced frequency bins)
+///
+/// This is computed from the Spectrogram output by a precomputed sparse
+/// spectral kernel, hence it shares its analysis window: the temporal
+/// kernels are bounded by the window length, lowest bins do not keep a
+/// constant Q if it is too short for them.
+class ConstantQ : public Descriptor_Interface {
+ public:
+  explicit ConstantQ(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const spectrogram,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+ private:
+  // No assignment operator for this class
+  ConstantQ& operator=(const ConstantQ& right);
+
+  const algorithms::ConstantQKernel& kernel_;
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_CONSTANTQ_H_
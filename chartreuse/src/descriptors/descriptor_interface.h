@@ -82,6 +82,49 @@ class Descriptor_Interface {
   /// @brief Retrieve descriptor metadata
   virtual Descriptor_Meta Meta(void) const = 0;
 
+  /// @brief Check if the descriptor processing may be skipped on silence
+  ///
+  /// Only expensive descriptors with a well-defined silent value override
+  /// this: stateful descriptors are never gated.
+  virtual bool IsGated(void) const {
+    return false;
+  }
+
+  /// @brief Check if the descriptor state depends on all past frames
+  ///
+  /// Once enabled, such descriptors are computed by the manager for every
+  /// frame, whether they are retrieved or not.
+  virtual bool IsStateful(void) const {
+    return false;
+  }
+
+  /// @brief Output for a frame below the manager silence threshold
+  ///
+  /// Called instead of the actual processing for gated descriptors.
+  /// By default the output is left untouched, e.g. the previous value is held.
+  ///
+  /// @param[out]  data     Descriptor output data
+  virtual void Silence(float* const /*data*/) {
+    // Nothing to do here for now
+  }
+
+  /// @brief Set the descriptor internal state back to its initial value
+  ///
+  /// Only stateful descriptors (e.g. depending on past frames) have to
+  /// override this.
+  virtual void Reset(void) {
+    // Nothing to do here for now
+  }
+
+  /// @brief Copy the internal state of the given descriptor
+  ///
+  /// The given descriptor has to be of the same type, and built from the
+  /// same analysis parameters: this allows a manager to be cloned without
+  /// rebuilding anything. Only stateful descriptors have to override this.
+  virtual void CopyState(const Descriptor_Interface& /*other*/) {
+    // Nothing to do here for now
+  }
+
  protected:
   interface::Manager* const manager_;  ///< Internal access to common manager
 
@@ -0,0 +1,77 @@
+/// @file harmonicspectralcentroid.cc
+/// @brief HarmonicSpectralCentroid descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/harmonicspectralcentroid.h"
+
+#include "chartreuse/src/algorithms/harmonicpeaks.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+float HarmonicCentroid(const float* const harmonic_peaks) {
+  CHARTREUSE_ASSERT(harmonic_peaks != nullptr);
+
+  float weighted_sum(0.0f);
+  float amplitude_sum(0.0f);
+  for (unsigned int harmonic(0);
+       harmonic < algorithms::HarmonicsCount(harmonic_peaks);
+       ++harmonic) {
+    const float* const kPeak(algorithms::HarmonicPeakData(harmonic_peaks,
+                                                          harmonic));
+    const float kAmplitude(kPeak[algorithms::HarmonicPeak::kAmplitude]);
+    weighted_sum += kPeak[algorithms::HarmonicPeak::kFrequency] * kAmplitude;
+    amplitude_sum += kAmplitude;
+  }
+  return (amplitude_sum > 0.0f) ? weighted_sum / amplitude_sum : 0.0f;
+}
+
+HarmonicSpectralCentroid::HarmonicSpectralCentroid(interface::Manager* manager)
+    : Descriptor_Interface(manager) {
+  // Nothing to do here for now
+}
+
+void HarmonicSpectralCentroid::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kHarmonicPeaks),
+          output);
+}
+
+void HarmonicSpectralCentroid::Process(const float* const harmonic_peaks,
+                                       float* const output) {
+  CHARTREUSE_ASSERT(harmonic_peaks != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(harmonic_peaks != output);
+
+  output[0] = HarmonicCentroid(harmonic_peaks);
+}
+
+Descriptor_Meta HarmonicSpectralCentroid::Meta(void) const {
+  return Descriptor_Meta(
+    1,
+    0.0f,
+    manager_->AnalysisParameters().sampling_freq / 2.0f);
+}
+
+bool HarmonicSpectralCentroid::IsGated(void) const {
+  return true;
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
@@ -0,0 +1,89 @@
+/// @file harmonicspectraldeviation.cc
+/// @brief HarmonicSpectralDeviation descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/harmonicspectraldeviation.h"
+
+// std::fabs
+#include <cmath>
+
+#include "chartreuse/src/algorithms/harmonicpeaks.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+HarmonicSpectralDeviation::HarmonicSpectralDeviation(interface::Manager* manager)
+    : Descriptor_Interface(manager) {
+  // Nothing to do here for now
+}
+
+void HarmonicSpectralDeviation::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kHarmonicPeaks),
+          output);
+}
+
+void HarmonicSpectralDeviation::Process(const float* const harmonic_peaks,
+                                        float* const output) {
+  CHARTREUSE_ASSERT(harmonic_peaks != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(harmonic_peaks != output);
+
+  const unsigned int kHarmonicsCount(
+    algorithms::HarmonicsCount(harmonic_peaks));
+  float deviation_sum(0.0f);
+  float amplitude_sum(0.0f);
+  for (unsigned int harmonic(0); harmonic < kHarmonicsCount; ++harmonic) {
+    // Spectral envelope: mean of the amplitudes of the harmonic
+    // and its existing neighbours
+    const unsigned int kFirst((harmonic > 0) ? harmonic - 1 : 0);
+    const unsigned int kLast((harmonic + 1 < kHarmonicsCount)
+                             ? harmonic + 1
+                             : harmonic);
+    float envelope(0.0f);
+    for (unsigned int neighbour(kFirst); neighbour <= kLast; ++neighbour) {
+      envelope += algorithms::HarmonicPeakData(harmonic_peaks, neighbour)
+        [algorithms::HarmonicPeak::kAmplitude];
+    }
+    envelope /= static_cast<float>(kLast - kFirst + 1);
+    const float kAmplitude(algorithms::HarmonicPeakData(harmonic_peaks,
+                                                        harmonic)
+      [algorithms::HarmonicPeak::kAmplitude]);
+    deviation_sum += std::fabs(kAmplitude - envelope);
+    amplitude_sum += kAmplitude;
+  }
+  output[0] = (amplitude_sum > 0.0f) ? deviation_sum / amplitude_sum : 0.0f;
+}
+
+Descriptor_Meta HarmonicSpectralDeviation::Meta(void) const {
+  // Each amplitude weighs at most 5/3 in the deviations sum:
+  // 2/3 by itself, 1/2 from a 2-harmonics edge envelope on each side
+  // (middle harmonic out of 3), hence the ratio bound
+  return Descriptor_Meta(
+    1,
+    0.0f,
+    5.0f / 3.0f);
+}
+
+bool HarmonicSpectralDeviation::IsGated(void) const {
+  return true;
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
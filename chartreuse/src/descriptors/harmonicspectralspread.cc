@@ -0,0 +1,85 @@
+/// @file harmonicspectralspread.cc
+/// @brief HarmonicSpectralSpread descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/harmonicspectralspread.h"
+
+// std::min
+#include <algorithm>
+// std::sqrt
+#include <cmath>
+
+#include "chartreuse/src/algorithms/harmonicpeaks.h"
+#include "chartreuse/src/descriptors/harmonicspectralcentroid.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+HarmonicSpectralSpread::HarmonicSpectralSpread(interface::Manager* manager)
+    : Descriptor_Interface(manager) {
+  // Nothing to do here for now
+}
+
+void HarmonicSpectralSpread::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kHarmonicPeaks),
+          output);
+}
+
+void HarmonicSpectralSpread::Process(const float* const harmonic_peaks,
+                                     float* const output) {
+  CHARTREUSE_ASSERT(harmonic_peaks != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(harmonic_peaks != output);
+
+  const float kCentroid(HarmonicCentroid(harmonic_peaks));
+  float weighted_sum(0.0f);
+  float power_sum(0.0f);
+  for (unsigned int harmonic(0);
+       harmonic < algorithms::HarmonicsCount(harmonic_peaks);
+       ++harmonic) {
+    const float* const kPeak(algorithms::HarmonicPeakData(harmonic_peaks,
+                                                          harmonic));
+    const float kAmplitude(kPeak[algorithms::HarmonicPeak::kAmplitude]);
+    const float kDistance(kPeak[algorithms::HarmonicPeak::kFrequency]
+                          - kCentroid);
+    weighted_sum += kAmplitude * kAmplitude * kDistance * kDistance;
+    power_sum += kAmplitude * kAmplitude;
+  }
+  if ((power_sum > 0.0f) && (kCentroid > 0.0f)) {
+    output[0] = std::min(std::sqrt(weighted_sum / power_sum) / kCentroid,
+                         kMaxHarmonicSpectralSpread);
+  } else {
+    output[0] = 0.0f;
+  }
+}
+
+Descriptor_Meta HarmonicSpectralSpread::Meta(void) const {
+  return Descriptor_Meta(
+    1,
+    0.0f,
+    kMaxHarmonicSpectralSpread);
+}
+
+bool HarmonicSpectralSpread::IsGated(void) const {
+  return true;
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
@@ -0,0 +1,60 @@
+/// @file harmonicspectralspread.h
+/// @brief HarmonicSpectralSpread descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_HARMONICSPECTRALSPREAD_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_HARMONICSPECTRALSPREAD_H_
+
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+/// @brief Output upper bound: relative spreads of actual harmonic series are
+/// bounded by the harmonics count, only degenerate peaks lists are clamped
+static const float kMaxHarmonicSpectralSpread(64.0f);
+
+/// @brief HarmonicSpectralSpread descriptor: for each frame, retrieve the
+/// amplitude-weighted standard deviation of its harmonic peaks frequencies
+/// around their centroid, relatively to the centroid
+class HarmonicSpectralSpread : public Descriptor_Interface {
+ public:
+  explicit HarmonicSpectralSpread(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const harmonic_peaks,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+  /// @brief Skipped on silent frames, the previous value being held
+  bool IsGated(void) const;
+
+ private:
+  // No assignment operator for this class
+  HarmonicSpectralSpread& operator=(const HarmonicSpectralSpread& right);
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_HARMONICSPECTRALSPREAD_H_
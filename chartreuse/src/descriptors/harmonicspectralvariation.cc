@@ -0,0 +1,96 @@
+/// @file harmonicspectralvariation.cc
+/// @brief HarmonicSpectralVariation descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/harmonicspectralvariation.h"
+
+// std::max, std::min
+#include <algorithm>
+// std::sqrt
+#include <cmath>
+
+#include "chartreuse/src/algorithms/harmonicpeaks.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+HarmonicSpectralVariation::HarmonicSpectralVariation(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      previous_amplitudes_(algorithms::kMaxHarmonicsCount, 0.0f) {
+  // Nothing to do here for now
+}
+
+void HarmonicSpectralVariation::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kHarmonicPeaks),
+          output);
+}
+
+void HarmonicSpectralVariation::Process(const float* const harmonic_peaks,
+                                        float* const output) {
+  CHARTREUSE_ASSERT(harmonic_peaks != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(harmonic_peaks != output);
+
+  const unsigned int kHarmonicsCount(
+    algorithms::HarmonicsCount(harmonic_peaks));
+  float correlation(0.0f);
+  float power(0.0f);
+  float previous_power(0.0f);
+  for (unsigned int harmonic(0);
+       harmonic < algorithms::kMaxHarmonicsCount;
+       ++harmonic) {
+    // Missing harmonics are considered null
+    const float kAmplitude((harmonic < kHarmonicsCount)
+      ? algorithms::HarmonicPeakData(harmonic_peaks, harmonic)
+          [algorithms::HarmonicPeak::kAmplitude]
+      : 0.0f);
+    const float kPrevious(previous_amplitudes_[harmonic]);
+    correlation += kAmplitude * kPrevious;
+    power += kAmplitude * kAmplitude;
+    previous_power += kPrevious * kPrevious;
+    previous_amplitudes_[harmonic] = kAmplitude;
+  }
+  if ((power > 0.0f) && (previous_power > 0.0f)) {
+    const float kNormalized(correlation / std::sqrt(power * previous_power));
+    output[0] = std::max(0.0f, std::min(1.0f, 1.0f - kNormalized));
+  } else {
+    output[0] = 0.0f;
+  }
+}
+
+Descriptor_Meta HarmonicSpectralVariation::Meta(void) const {
+  return Descriptor_Meta(
+    1,
+    0.0f,
+    1.0f);
+}
+
+void HarmonicSpectralVariation::Reset(void) {
+  std::fill(previous_amplitudes_.begin(), previous_amplitudes_.end(), 0.0f);
+}
+
+void HarmonicSpectralVariation::CopyState(const Descriptor_Interface& other) {
+  // Same length: no reallocation here
+  previous_amplitudes_
+    = static_cast<const HarmonicSpectralVariation&>(other).previous_amplitudes_;
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
@@ -0,0 +1,82 @@
+/// @file logattacktime.cc
+/// @brief LogAttackTime descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/logattacktime.h"
+
+// std::max, std::min
+#include <algorithm>
+// std::log10
+#include <cmath>
+
+#include "chartreuse/src/descriptors/signalenvelope.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+LogAttackTime::LogAttackTime(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      tracker_(kAttackFloor,
+               1.0f,
+               kAttackLevelsPerDecade,
+               manager->AnalysisParameters().hop_size_sample
+               / manager->AnalysisParameters().sampling_freq),
+      min_duration_(1.0f / manager->AnalysisParameters().sampling_freq) {
+  // Nothing to do here for now
+}
+
+void LogAttackTime::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kSignalEnvelope),
+          output);
+}
+
+void LogAttackTime::Process(const float* const signal_envelope,
+                            float* const output) {
+  CHARTREUSE_ASSERT(signal_envelope != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(signal_envelope != output);
+
+  tracker_.Push(signal_envelope[0]);
+  const float kDuration(tracker_.CrossingTime(kAttackStopRatio)
+                        - tracker_.CrossingTime(kAttackStartRatio));
+  output[0] = std::log10(std::min(std::max(kDuration, min_duration_),
+                                  kTemporalMaxDuration));
+}
+
+Descriptor_Meta LogAttackTime::Meta(void) const {
+  return Descriptor_Meta(1,
+                         std::log10(min_duration_),
+                         std::log10(kTemporalMaxDuration));
+}
+
+bool LogAttackTime::IsStateful(void) const {
+  return true;
+}
+
+void LogAttackTime::Reset(void) {
+  tracker_.Reset();
+}
+
+void LogAttackTime::CopyState(const Descriptor_Interface& other) {
+  tracker_.CopyState(static_cast<const LogAttackTime&>(other).tracker_);
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
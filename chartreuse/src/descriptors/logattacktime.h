@@ -0,0 +1,80 @@
+/// @file logattacktime.h
+/// @brief LogAttackTime descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_LOGATTACKTIME_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_LOGATTACKTIME_H_
+
+#include "chartreuse/src/algorithms/envelopefollower.h"
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+/// @brief Attack start, as a ratio of the envelope maximum
+static const float kAttackStartRatio(0.02f);
+/// @brief Attack stop, as a ratio of the envelope maximum
+static const float kAttackStopRatio(0.9f);
+/// @brief Lowest envelope level considered for the attack
+static const float kAttackFloor(1e-5f);
+/// @brief Attack envelope levels resolution (1dB)
+static const unsigned int kAttackLevelsPerDecade(20);
+
+/// @brief LogAttackTime descriptor: for each frame, retrieve the decimal
+/// logarithm of the attack duration (in seconds) of the current segment
+///
+/// The attack lasts from the envelope reaching kAttackStartRatio of its
+/// maximum to kAttackStopRatio of it, the latter being more robust to
+/// sustain fluctuations than the maximum itself.
+/// It is updated incrementally with each frame envelope, without buffering
+/// the whole segment: hence once enabled
+/// it is updated for every frame, retrieved or not.
+class LogAttackTime : public Descriptor_Interface {
+ public:
+  explicit LogAttackTime(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const signal_envelope,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+  /// @brief Updated for every frame
+  bool IsStateful(void) const;
+
+  /// @brief Start a new segment
+  void Reset(void);
+
+  void CopyState(const Descriptor_Interface& other);
+
+ private:
+  // No assignment operator for this class
+  LogAttackTime& operator=(const LogAttackTime& right);
+
+  algorithms::AttackTracker tracker_;
+  const float min_duration_;  ///< Shortest attack duration (one sample)
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_LOGATTACKTIME_H_
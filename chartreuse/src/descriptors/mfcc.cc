@@ -0,0 +1,75 @@
+/// @file mfcc.cc
+/// @brief MFCC descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/mfcc.h"
+
+// std::max
+#include <algorithm>
+// std::abs, std::log, std::sqrt
+#include <cmath>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/algorithms/dct.h"
+#include "chartreuse/src/algorithms/workspace.h"
+#include "chartreuse/src/descriptors/melbands.h"
+#include "chartreuse/src/interface/analysiscontext.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+MFCC::MFCC(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      dct_(manager->Context().MfccDct()) {
+  // Nothing to do here for now
+}
+
+void MFCC::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kMelBands),
+          output);
+}
+
+void MFCC::Process(const float* const mel_bands,
+                   float* const output) {
+  CHARTREUSE_ASSERT(mel_bands != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(mel_bands != output);
+
+  algorithms::Workspace::Scope scope(&manager_->Scratch());
+  float* const log_bands(scope.Floats(kMelBandsCount));
+  Eigen::Map<Eigen::ArrayXf>(&log_bands[0], kMelBandsCount)
+    = Eigen::Map<const Eigen::ArrayXf>(mel_bands, kMelBandsCount)
+        .max(kMfccPowerFloor).log();
+  dct_.Apply(&log_bands[0], output);
+}
+
+Descriptor_Meta MFCC::Meta(void) const {
+  // Any coefficient is at most sqrt(2 / N) times the sum of the log bands
+  const unsigned int kDftLength(manager_->AnalysisParameters().dft_length);
+  const float kMaxLog(std::max(
+    std::abs(std::log(kMfccPowerFloor)),
+    std::abs(std::log(static_cast<float>(kDftLength * kDftLength)))));
+  const float kMaxCoeff(std::sqrt(2.0f * kMelBandsCount) * kMaxLog);
+  return Descriptor_Meta(kMfccCount, -kMaxCoeff, kMaxCoeff);
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
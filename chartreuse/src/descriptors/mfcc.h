@@ -0,0 +1,66 @@
+/// @file mfcc.h
+/// @brief MFCC descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_MFCC_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_MFCC_H_
+
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+
+// Internal forward declaration
+namespace algorithms {
+class Dct;
+}  // namespace algorithms
+
+namespace descriptors {
+
+/// @brief Number of computed cepstral coefficients
+static const unsigned int kMfccCount(13);
+
+/// @brief Mel bands power floor, preventing log(0) on silent frames
+static const float kMfccPowerFloor(1e-10f);
+
+/// @brief MFCC descriptor: for each frame, retrieve the Mel-Frequency
+/// Cepstral Coefficients, the orthonormal DCT-II of the log Mel bands power
+class MFCC : public Descriptor_Interface {
+ public:
+  explicit MFCC(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const mel_bands,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+ private:
+  // No assignment operator for this class
+  MFCC& operator=(const MFCC& right);
+
+  const algorithms::Dct& dct_;
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_MFCC_H_
@@ -0,0 +1,117 @@
+/// @file onsetstrength.cc
+/// @brief OnsetStrength descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/onsetstrength.h"
+
+#include <algorithm>
+
+#include "Eigen/Core"
+
+#include "chartreuse/src/algorithms/spectrumhistory.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+OnsetStrength::OnsetStrength(interface::Manager* manager)
+    : Descriptor_Interface(manager) {
+  // Nothing to do here for now
+}
+
+void OnsetStrength::operator()(float* const output) {
+  algorithms::SpectrumHistory& history(manager_->PastSpectra());
+  history.Activate();
+  // Always retrieved, so that the history gets this frame spectrum
+  const float* const spectrum(
+    manager_->GetDescriptor(interface::DescriptorId::kDft));
+  // Comparing against the null spectra of an empty history
+  // would report a spurious onset
+  if (history.Count() < 2) {
+    std::fill(output, output + OnsetFunction::kCount, 0.0f);
+    return;
+  }
+  Process(spectrum,
+          history.Spectrum(1),
+          history.Magnitudes(1),
+          history.LogMagnitudes(1),
+          history.Spectrum(2),
+          history.Magnitudes(2),
+          history.SpectrumLength(),
+          output);
+}
+
+void OnsetStrength::Process(const float* const spectrum,
+                            const std::complex<float>* const previous_spectrum,
+                            const float* const previous_magnitudes,
+                            const float* const previous_log_magnitudes,
+                            const std::complex<float>* const older_spectrum,
+                            const float* const older_magnitudes,
+                            const unsigned int spectrum_length,
+                            float* const output) {
+  CHARTREUSE_ASSERT(spectrum != nullptr);
+  CHARTREUSE_ASSERT(previous_spectrum != nullptr);
+  CHARTREUSE_ASSERT(previous_magnitudes != nullptr);
+  CHARTREUSE_ASSERT(previous_log_magnitudes != nullptr);
+  CHARTREUSE_ASSERT(older_spectrum != nullptr);
+  CHARTREUSE_ASSERT(older_magnitudes != nullptr);
+  CHARTREUSE_ASSERT(spectrum_length > 0);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(spectrum != output);
+
+  const Eigen::Map<const Eigen::ArrayXcf> current(
+    reinterpret_cast<const std::complex<float>*>(spectrum),
+    spectrum_length);
+  const Eigen::Map<const Eigen::ArrayXcf> previous(previous_spectrum,
+                                                   spectrum_length);
+  const Eigen::Map<const Eigen::ArrayXcf> older(older_spectrum,
+                                                spectrum_length);
+  const Eigen::Map<const Eigen::ArrayXf> previous_mag(previous_magnitudes,
+                                                      spectrum_length);
+  const Eigen::Map<const Eigen::ArrayXf> previous_log_mag(
+    previous_log_magnitudes,
+    spectrum_length);
+  const Eigen::Map<const Eigen::ArrayXf> older_mag(older_magnitudes,
+                                                   spectrum_length);
+  // Lazy expressions only, not to allocate any temporary
+  output[OnsetFunction::kSpectralFlux]
+    = (current.abs() - previous_mag).max(0.0f).sum();
+  output[OnsetFunction::kLogFlux]
+    = ((current.abs() + 1.0f).log() - previous_log_mag).max(0.0f).sum();
+  // Target: |X(t-1)| * exp(i * (2 * phi(t-1) - phi(t-2))),
+  // which is X(t-1)^2 * conj(X(t-2)) / (|X(t-1)| * |X(t-2)|)
+  output[OnsetFunction::kComplexDomain]
+    = (current - previous.square() * older.conjugate()
+                 * (previous_mag * older_mag).max(kOnsetPhaseFloor).inverse()
+                     .cast<std::complex<float> >()).abs().sum();
+}
+
+Descriptor_Meta OnsetStrength::Meta(void) const {
+  // Dft magnitudes are bounded by the frame length,
+  // the complex domain distance being at most twice these
+  const float kDftLength(static_cast<float>(
+    manager_->AnalysisParameters().dft_length));
+  const float kBinsCount(kDftLength / 2.0f + 1.0f);
+  return Descriptor_Meta(OnsetFunction::kCount,
+                         0.0f,
+                         2.0f * kDftLength * kBinsCount);
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
@@ -0,0 +1,95 @@
+/// @file onsetstrength.h
+/// @brief OnsetStrength descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_ONSETSTRENGTH_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_ONSETSTRENGTH_H_
+
+// std::complex
+#include <complex>
+
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+// Using the namespace trick for easier enum scoping
+namespace OnsetFunction {
+
+/// @brief Layout of the OnsetStrength output, one value per onset function
+enum Type {
+  kSpectralFlux = 0,
+  kLogFlux,
+  kComplexDomain,
+  kCount
+};
+
+}  // namespace OnsetFunction
+
+/// @brief Floor for the past magnitudes product in the phase prediction
+static const float kOnsetPhaseFloor(1e-10f);
+
+/// @brief OnsetStrength descriptor: for each frame, retrieve onset detection
+/// functions values, computed from the current and past spectra
+///
+/// - Spectral flux: half-wave rectified magnitude difference
+/// - Log flux: half-wave rectified log(1 + magnitude) difference
+/// - Complex domain: distance to the spectrum predicted from the previous
+/// frames, assuming constant magnitudes and phase derivatives
+///
+/// Past spectra are retrieved from the manager history, which is
+/// activated on the first call: all outputs are null until it holds the
+/// two previous frames spectra (also after each manager reset).
+class OnsetStrength : public Descriptor_Interface {
+ public:
+  explicit OnsetStrength(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  ///
+  /// @param[in]  spectrum   Current interleaved complex spectrum
+  /// @param[in]  previous_spectrum   Previous frame complex spectrum
+  /// @param[in]  previous_magnitudes   Previous frame magnitudes
+  /// @param[in]  previous_log_magnitudes   Previous frame log(1 + magnitudes)
+  /// @param[in]  older_spectrum   Complex spectrum from 2 frames ago
+  /// @param[in]  older_magnitudes   Magnitudes from 2 frames ago
+  /// @param[in]  spectrum_length   Complex spectra length
+  /// @param[out]  output   One value per onset function
+  void Process(const float* const spectrum,
+               const std::complex<float>* const previous_spectrum,
+               const float* const previous_magnitudes,
+               const float* const previous_log_magnitudes,
+               const std::complex<float>* const older_spectrum,
+               const float* const older_magnitudes,
+               const unsigned int spectrum_length,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+ private:
+  // No assignment operator for this class
+  OnsetStrength& operator=(const OnsetStrength& right);
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_ONSETSTRENGTH_H_
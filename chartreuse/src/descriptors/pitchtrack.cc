@@ -0,0 +1,75 @@
+/// @file pitchtrack.cc
+/// @brief PitchTrack descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/pitchtrack.h"
+
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+PitchTrack::PitchTrack(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      tracker_() {
+  // Nothing to do here for now
+}
+
+void PitchTrack::operator()(float* const output) {
+  Process(
+    manager_->GetDescriptor(interface::DescriptorId::kNormalizedDifference),
+    manager_->AnalysisParameters().min_lag,
+    manager_->AnalysisParameters().max_lag,
+    output);
+}
+
+void PitchTrack::Process(const float* const normalized_difference,
+                         const unsigned int min_lag,
+                         const unsigned int max_lag,
+                         float* const output) {
+  CHARTREUSE_ASSERT(normalized_difference != nullptr);
+  CHARTREUSE_ASSERT(min_lag > 0);
+  CHARTREUSE_ASSERT(max_lag > min_lag);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(output != normalized_difference);
+
+  output[0] = tracker_.Process(normalized_difference, min_lag, max_lag);
+}
+
+Descriptor_Meta PitchTrack::Meta(void) const {
+  return Descriptor_Meta(
+    1,
+    static_cast<float>(manager_->AnalysisParameters().min_lag),
+    static_cast<float>(manager_->AnalysisParameters().max_lag));
+}
+
+bool PitchTrack::IsStateful(void) const {
+  return true;
+}
+
+void PitchTrack::Reset(void) {
+  tracker_.Reset();
+}
+
+void PitchTrack::CopyState(const Descriptor_Interface& other) {
+  tracker_.CopyState(static_cast<const PitchTrack&>(other).tracker_);
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
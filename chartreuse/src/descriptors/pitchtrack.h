@@ -0,0 +1,70 @@
+/// @file pitchtrack.h
+/// @brief PitchTrack descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_PITCHTRACK_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_PITCHTRACK_H_
+
+#include "chartreuse/src/algorithms/pitchtracker.h"
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+/// @brief PitchTrack descriptor: smoothed fundamental period, tracked
+/// across hops amongst the best normalized difference (YIN CMNDF) dips
+///
+/// Output is delayed by algorithms::kPitchTrackLatency hops, in the same
+/// domain as AudioFundamentalFrequency.
+/// Being a stateful descriptor, once enabled it is updated for every frame,
+/// retrieved or not.
+class PitchTrack : public Descriptor_Interface {
+ public:
+  explicit PitchTrack(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const normalized_difference,
+               const unsigned int min_lag,
+               const unsigned int max_lag,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+  /// @brief Updated for every frame
+  bool IsStateful(void) const;
+
+  /// @brief Forget all previous hops
+  void Reset(void);
+
+  void CopyState(const Descriptor_Interface& other);
+
+ private:
+  // No assignment operator for this class
+  PitchTrack& operator=(const PitchTrack& right);
+
+  algorithms::PitchTracker tracker_;
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_PITCHTRACK_H_
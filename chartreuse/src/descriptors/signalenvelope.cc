@@ -0,0 +1,71 @@
+/// @file signalenvelope.cc
+/// @brief SignalEnvelope descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/signalenvelope.h"
+
+// std::sqrt
+#include <cmath>
+
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+SignalEnvelope::SignalEnvelope(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      follower_(kEnvelopeAttackTime,
+                kEnvelopeReleaseTime,
+                manager->AnalysisParameters().hop_size_sample
+                / manager->AnalysisParameters().sampling_freq) {
+  // Nothing to do here for now
+}
+
+void SignalEnvelope::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kAudioPower),
+          output);
+}
+
+void SignalEnvelope::Process(const float* const audio_power,
+                             float* const output) {
+  CHARTREUSE_ASSERT(audio_power != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(audio_power != output);
+
+  output[0] = follower_.Process(std::sqrt(audio_power[0]));
+}
+
+Descriptor_Meta SignalEnvelope::Meta(void) const {
+  return Descriptor_Meta(1, 0.0f, 1.0f);
+}
+
+bool SignalEnvelope::IsStateful(void) const {
+  return true;
+}
+
+void SignalEnvelope::Reset(void) {
+  follower_.Reset();
+}
+
+void SignalEnvelope::CopyState(const Descriptor_Interface& other) {
+  follower_.CopyState(static_cast<const SignalEnvelope&>(other).follower_);
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
@@ -0,0 +1,74 @@
+/// @file signalenvelope.h
+/// @brief SignalEnvelope descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_SIGNALENVELOPE_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_SIGNALENVELOPE_H_
+
+#include "chartreuse/src/algorithms/envelopefollower.h"
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+/// @brief Envelope attack time constant, in seconds
+static const float kEnvelopeAttackTime(0.005f);
+/// @brief Envelope release time constant, in seconds
+static const float kEnvelopeReleaseTime(0.1f);
+/// @brief Longest segment duration for temporal descriptors, in seconds:
+/// their output saturates above it
+static const float kTemporalMaxDuration(60.0f);
+
+/// @brief SignalEnvelope descriptor: for each frame, retrieve the amplitude
+/// envelope of the signal, e.g. its smoothed RMS value
+///
+/// Being a stateful descriptor, once enabled it is updated for every frame,
+/// retrieved or not.
+class SignalEnvelope : public Descriptor_Interface {
+ public:
+  explicit SignalEnvelope(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const audio_power,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+  /// @brief Updated for every frame
+  bool IsStateful(void) const;
+
+  /// @brief Set the envelope back to zero
+  void Reset(void);
+
+  void CopyState(const Descriptor_Interface& other);
+
+ private:
+  // No assignment operator for this class
+  SignalEnvelope& operator=(const SignalEnvelope& right);
+
+  algorithms::EnvelopeFollower follower_;
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_SIGNALENVELOPE_H_
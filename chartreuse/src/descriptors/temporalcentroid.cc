@@ -0,0 +1,85 @@
+/// @file temporalcentroid.cc
+/// @brief TemporalCentroid descriptor implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/descriptors/temporalcentroid.h"
+
+// std::min
+#include <algorithm>
+
+#include "chartreuse/src/descriptors/signalenvelope.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+TemporalCentroid::TemporalCentroid(interface::Manager* manager)
+    : Descriptor_Interface(manager),
+      frame_duration_(manager->AnalysisParameters().hop_size_sample
+                      / manager->AnalysisParameters().sampling_freq),
+      frame_idx_(0),
+      envelope_sum_(0.0),
+      weighted_sum_(0.0) {
+  // Nothing to do here for now
+}
+
+void TemporalCentroid::operator()(float* const output) {
+  Process(manager_->GetDescriptor(interface::DescriptorId::kSignalEnvelope),
+          output);
+}
+
+void TemporalCentroid::Process(const float* const signal_envelope,
+                               float* const output) {
+  CHARTREUSE_ASSERT(signal_envelope != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+  CHARTREUSE_ASSERT(signal_envelope != output);
+
+  envelope_sum_ += signal_envelope[0];
+  weighted_sum_ += static_cast<double>(frame_idx_) * signal_envelope[0];
+  frame_idx_ += 1;
+  const float kCentroid(envelope_sum_ > 0.0 ?
+                        static_cast<float>(weighted_sum_ / envelope_sum_)
+                        * frame_duration_
+                        : 0.0f);
+  output[0] = std::min(kCentroid, kTemporalMaxDuration);
+}
+
+Descriptor_Meta TemporalCentroid::Meta(void) const {
+  return Descriptor_Meta(1, 0.0f, kTemporalMaxDuration);
+}
+
+bool TemporalCentroid::IsStateful(void) const {
+  return true;
+}
+
+void TemporalCentroid::Reset(void) {
+  frame_idx_ = 0;
+  envelope_sum_ = 0.0;
+  weighted_sum_ = 0.0;
+}
+
+void TemporalCentroid::CopyState(const Descriptor_Interface& other) {
+  const TemporalCentroid& kOther(static_cast<const TemporalCentroid&>(other));
+  frame_idx_ = kOther.frame_idx_;
+  envelope_sum_ = kOther.envelope_sum_;
+  weighted_sum_ = kOther.weighted_sum_;
+}
+
+}  // namespace descriptors
+}  // namespace chartreuse
@@ -0,0 +1,73 @@
+/// @file temporalcentroid.h
+/// @brief TemporalCentroid descriptor declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_DESCRIPTORS_TEMPORALCENTROID_H_
+#define CHARTREUSE_SRC_DESCRIPTORS_TEMPORALCENTROID_H_
+
+// std::size_t
+#include <cstddef>
+
+#include "chartreuse/src/descriptors/descriptor_interface.h"
+
+namespace chartreuse {
+namespace descriptors {
+
+/// @brief TemporalCentroid descriptor: for each frame, retrieve the time
+/// averaged over the current segment envelope (in seconds since its start)
+///
+/// It is updated incrementally with each frame envelope, without buffering
+/// the whole segment: hence once enabled
+/// it is updated for every frame, retrieved or not.
+class TemporalCentroid : public Descriptor_Interface {
+ public:
+  explicit TemporalCentroid(interface::Manager* manager);
+
+  void operator()(float* const output);
+
+  /// @brief Independent process method: this is where the actual computation
+  /// is done, to be used in a "raw" way when no manager is available
+  void Process(const float* const signal_envelope,
+               float* const output);
+
+  Descriptor_Meta Meta(void) const;
+
+  /// @brief Updated for every frame
+  bool IsStateful(void) const;
+
+  /// @brief Start a new segment
+  void Reset(void);
+
+  void CopyState(const Descriptor_Interface& other);
+
+ private:
+  // No assignment operator for this class
+  TemporalCentroid& operator=(const TemporalCentroid& right);
+
+  const float frame_duration_;
+  std::size_t frame_idx_;
+  // Accumulated over possibly long segments, hence the double precision
+  double envelope_sum_;
+  double weighted_sum_;  ///< Sum of the envelope weighted by frame index
+};
+
+}  // namespace descriptors
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_DESCRIPTORS_TEMPORALCENTROID_H_
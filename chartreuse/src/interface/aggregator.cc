@@ -0,0 +1,93 @@
+/// @file aggregator.cc
+/// @brief Aggregator class implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/interface/aggregator.h"
+
+// std::copy_n
+#include <algorithm>
+
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace interface {
+
+Aggregator::Aggregator(Manager* const manager,
+                       const std::vector<DescriptorId::Type>& descriptors,
+                       const unsigned int texture_length,
+                       const std::vector<float>& quantiles)
+    : manager_(manager),
+      descriptors_(descriptors),
+      texture_length_(texture_length),
+      statistics_(Dimensions(manager, descriptors), quantiles),
+      frame_(Dimensions(manager, descriptors)),
+      summary_(statistics_.SummaryLength()) {
+  // Nothing to do here for now
+}
+
+Aggregator::~Aggregator() {
+  // Nothing to do here for now
+}
+
+bool Aggregator::Process(void) {
+  float* current_out(&frame_[0]);
+  for (const DescriptorId::Type descriptor : descriptors_) {
+    const unsigned int kDimensions(
+      manager_->GetDescriptorMeta(descriptor).out_dim);
+    std::copy_n(manager_->GetDescriptor(descriptor), kDimensions, current_out);
+    current_out += kDimensions;
+  }
+  statistics_.Push(&frame_[0]);
+  if ((texture_length_ > 0) && (statistics_.Count() >= texture_length_)) {
+    return Flush();
+  }
+  return false;
+}
+
+bool Aggregator::Flush(void) {
+  if (statistics_.Count() == 0) {
+    return false;
+  }
+  statistics_.Summary(&summary_[0]);
+  statistics_.Reset();
+  return true;
+}
+
+const float* Aggregator::Summary(void) const {
+  return &summary_[0];
+}
+
+unsigned int Aggregator::SummaryLength(void) const {
+  return statistics_.SummaryLength();
+}
+
+unsigned int Aggregator::Dimensions(
+    const Manager* const manager,
+    const std::vector<DescriptorId::Type>& descriptors) {
+  CHARTREUSE_ASSERT(manager != nullptr);
+  CHARTREUSE_ASSERT(!descriptors.empty());
+  unsigned int dimensions(0);
+  for (const DescriptorId::Type descriptor : descriptors) {
+    dimensions += manager->GetDescriptorMeta(descriptor).out_dim;
+  }
+  return dimensions;
+}
+
+}  // namespace interface
+}  // namespace chartreuse
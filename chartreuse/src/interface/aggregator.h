@@ -0,0 +1,98 @@
+/// @file aggregator.h
+/// @brief Aggregator class declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_INTERFACE_AGGREGATOR_H_
+#define CHARTREUSE_SRC_INTERFACE_AGGREGATOR_H_
+
+#include <vector>
+
+#include "chartreuse/src/common.h"
+
+#include "chartreuse/src/algorithms/segmentstatistics.h"
+#include "chartreuse/src/interface/interface_common.h"
+
+namespace chartreuse {
+namespace interface {
+
+// Internal forward declaration
+class Manager;
+
+/// @brief Aggregator class: summarizes descriptors over texture windows
+///
+/// To be run after each manager frame processing: the given descriptors are
+/// retrieved and accumulated, only their statistics being output once the
+/// texture window is over (mean, variance, min, max then quantiles,
+/// for each descriptor dimension).
+/// @see algorithms::SegmentStatistics
+class Aggregator {
+ public:
+  /// @brief Constructor
+  ///
+  /// @param[in]  manager    Manager to retrieve descriptors from
+  /// @param[in]  descriptors    Descriptors to be summarized
+  /// @param[in]  texture_length    Texture window length, in frames:
+  /// if 0, a single texture window lasts until Flush() is called
+  /// @param[in]  quantiles    Probabilities of the quantiles to be estimated
+  explicit Aggregator(Manager* const manager,
+                      const std::vector<DescriptorId::Type>& descriptors,
+                      const unsigned int texture_length,
+                      const std::vector<float>& quantiles);
+  ~Aggregator();
+
+  /// @brief Main processing function, to be called after each manager frame
+  ///
+  /// @return True if a texture window is over: its summary is then available
+  bool Process(void);
+
+  /// @brief End the current texture window, even if incomplete
+  ///
+  /// @return True if a summary is available, e.g. any frame was processed
+  bool Flush(void);
+
+  /// @brief Retrieve the last complete texture window summary,
+  /// of SummaryLength()
+  const float* Summary(void) const;
+
+  /// @brief Length of the summary output
+  unsigned int SummaryLength(void) const;
+
+ private:
+  // No assignment operator for this class
+  Aggregator& operator=(const Aggregator& right);
+  // No copy constructor for this class
+  Aggregator(const Aggregator& right);
+
+  /// @brief Helper retrieving the descriptors total dimensionality
+  static unsigned int Dimensions(
+    const Manager* const manager,
+    const std::vector<DescriptorId::Type>& descriptors);
+
+  Manager* const manager_;
+  const std::vector<DescriptorId::Type> descriptors_;
+  const unsigned int texture_length_;
+  algorithms::SegmentStatistics statistics_;
+  std::vector<float> frame_;  ///< All descriptors data for the current frame
+  std::vector<float> summary_;  ///< Last complete texture window summary
+};
+
+}  // namespace interface
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_INTERFACE_AGGREGATOR_H_
@@ -0,0 +1,135 @@
+/// @file allocationtracker.cc
+/// @brief Heap allocations tracking implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/interface/allocationtracker.h"
+
+// ENOMEM
+#include <cerrno>
+// std::fputs
+#include <cstdio>
+// std::abort, std::free, std::malloc
+#include <cstdlib>
+// std::bad_alloc
+#include <new>
+
+namespace chartreuse {
+namespace interface {
+
+/// @brief Current thread tracking state
+static thread_local bool tracking_enabled(false);
+static thread_local bool abort_on_allocation(false);
+static thread_local std::size_t allocations_count(0);
+
+/// @brief To be called by all intercepted allocation functions
+static inline void OnAllocation(void) {
+  if (tracking_enabled) {
+    if (abort_on_allocation) {
+      std::fputs("chartreuse: heap allocation within a tracked scope\n",
+                 stderr);
+      std::abort();
+    }
+    allocations_count += 1;
+  }
+}
+
+AllocationTracker::AllocationTracker(const AllocationPolicy::Type policy) {
+  CHARTREUSE_ASSERT(policy != AllocationPolicy::kCount);
+  CHARTREUSE_ASSERT(!tracking_enabled);
+  allocations_count = 0;
+  abort_on_allocation = policy == AllocationPolicy::kAbort;
+  tracking_enabled = true;
+}
+
+AllocationTracker::~AllocationTracker() {
+  tracking_enabled = false;
+}
+
+std::size_t AllocationTracker::AllocationsCount(void) const {
+  return allocations_count;
+}
+
+bool AllocationTracker::IsAvailable(void) {
+  return _USE_ALLOCATION_TRACKING;
+}
+
+}  // namespace interface
+}  // namespace chartreuse
+
+#if (_USE_ALLOCATION_TRACKING)
+#if defined(__GLIBC__)
+
+// On glibc the whole malloc family is interposed, operator new included
+extern "C" {
+
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t count, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+
+void* malloc(std::size_t size) __THROW {
+  chartreuse::interface::OnAllocation();
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) __THROW {
+  chartreuse::interface::OnAllocation();
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, std::size_t size) __THROW {
+  chartreuse::interface::OnAllocation();
+  return __libc_realloc(ptr, size);
+}
+
+int posix_memalign(void** ptr, std::size_t alignment, std::size_t size)
+    __THROW {
+  chartreuse::interface::OnAllocation();
+  *ptr = __libc_memalign(alignment, size);
+  return *ptr != nullptr ? 0 : ENOMEM;
+}
+
+}  // extern "C"
+
+#else  // defined(__GLIBC__)
+
+// Elsewhere, only operator new is replaced
+void* operator new(std::size_t size) {
+  chartreuse::interface::OnAllocation();
+  void* const ptr(std::malloc(size));
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new[](std::size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* ptr) throw() {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) throw() {
+  std::free(ptr);
+}
+
+#endif  // defined(__GLIBC__)
+#endif  // (_USE_ALLOCATION_TRACKING)
@@ -0,0 +1,75 @@
+/// @file allocationtracker.h
+/// @brief Heap allocations tracking declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_INTERFACE_ALLOCATIONTRACKER_H_
+#define CHARTREUSE_SRC_INTERFACE_ALLOCATIONTRACKER_H_
+
+#include "chartreuse/src/common.h"
+
+namespace chartreuse {
+namespace interface {
+
+// Using the namespace trick for easier enum scoping
+namespace AllocationPolicy {
+
+/// @brief What to do with a heap allocation within a tracked scope
+enum Type {
+  kReport = 0,  ///< Only count it
+  kAbort,  ///< Abort the program
+  kCount
+};
+
+}  // namespace AllocationPolicy
+
+/// @brief Allocation tracker: scoped heap allocations interception
+///
+/// Any heap allocation (malloc family, hence operator new) done by the
+/// current thread during the tracker lifetime is either counted or aborts.
+/// This is meant to check that the processing path is real-time safe,
+/// e.g. Manager::ProcessFrame and Manager::GetDescriptor.
+///
+/// Interception is only built if the _TRACK_ALLOCATIONS flag is defined
+/// (CHARTREUSE_TRACK_ALLOCATIONS CMake option): it replaces the global
+/// allocation functions, hence is for testing purpose only.
+/// Trackers cannot be nested.
+class AllocationTracker {
+ public:
+  /// @brief Start tracking allocations on the current thread
+  explicit AllocationTracker(const AllocationPolicy::Type policy);
+  /// @brief Stop tracking allocations on the current thread
+  ~AllocationTracker();
+
+  /// @brief Count of allocations since the tracker creation
+  std::size_t AllocationsCount(void) const;
+
+  /// @brief Check if allocations interception was built
+  static bool IsAvailable(void);
+
+ private:
+  // No assignment operator for this class
+  AllocationTracker& operator=(const AllocationTracker& right);
+  // No copy constructor for this class
+  AllocationTracker(const AllocationTracker& right);
+};
+
+}  // namespace interface
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_INTERFACE_ALLOCATIONTRACKER_H_
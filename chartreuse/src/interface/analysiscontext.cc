@@ -0,0 +1,141 @@
+/// @file analysiscontext.cc
+/// @brief AnalysisContext class implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/interface/analysiscontext.h"
+
+// std::min
+#include <algorithm>
+
+#include "chartreuse/src/descriptors/audiospectrumenvelope.h"
+#include "chartreuse/src/descriptors/audiospectrumflatness.h"
+#include "chartreuse/src/descriptors/barkbands.h"
+#include "chartreuse/src/descriptors/constantq.h"
+#include "chartreuse/src/descriptors/melbands.h"
+#include "chartreuse/src/descriptors/mfcc.h"
+
+namespace chartreuse {
+namespace interface {
+
+AnalysisContext::AnalysisContext(const Manager::Parameters& parameters)
+    : parameters_(parameters),
+      apodizer_(parameters.dft_length, algorithms::Window::kHamming),
+      frame_apodizer_(parameters.hop_size_sample, algorithms::Window::kHamming),
+      freq_scale_(parameters.high_edge - parameters.low_edge,
+                  algorithms::Scale::kLogFreq,
+                  parameters.dft_length,
+                  parameters.sampling_freq),
+      dft_plan_(parameters.dft_length),
+      // TODO(gm): remove this magic
+      spectrum_normalization_(parameters.dft_length * 571.865f),
+      mel_filter_bank_(algorithms::Bands::kMel,
+                       descriptors::kMelBandsCount,
+                       parameters.dft_length,
+                       parameters.sampling_freq,
+                       0.0f,
+                       parameters.sampling_freq / 2.0f),
+      bark_filter_bank_(algorithms::Bands::kBark,
+                        descriptors::kBarkBandsCount,
+                        parameters.dft_length,
+                        parameters.sampling_freq,
+                        0.0f,
+                        parameters.sampling_freq / 2.0f),
+      mfcc_dct_(descriptors::kMelBandsCount, descriptors::kMfccCount),
+      envelope_bands_(parameters.octave_resolution,
+                      descriptors::kEnvelopeLowEdge,
+                      descriptors::kEnvelopeHighEdge,
+                      parameters.dft_length,
+                      parameters.sampling_freq),
+      flatness_bands_(descriptors::kFlatnessResolution,
+                      descriptors::kFlatnessOverlap,
+                      descriptors::kFlatnessLowEdge,
+                      descriptors::kFlatnessHighEdge,
+                      descriptors::kFlatnessPowerFloor,
+                      parameters.dft_length,
+                      parameters.sampling_freq),
+      // Kernels lie within the actual data of the zero-padded window
+      constant_q_kernel_(descriptors::kConstantQMinFreq,
+                         descriptors::kConstantQBinsPerOctave,
+                         descriptors::kConstantQBinsCount,
+                         std::min(parameters.window_length,
+                                  parameters.dft_length),
+                         std::min(parameters.window_length,
+                                  parameters.dft_length) / 2,
+                         parameters.dft_length,
+                         parameters.sampling_freq,
+                         descriptors::kConstantQThreshold) {
+  CHARTREUSE_ASSERT(spectrum_normalization_ > 0.0f);
+}
+
+AnalysisContext::~AnalysisContext() {
+  // Nothing to do here for now
+}
+
+const Manager::Parameters& AnalysisContext::AnalysisParameters(void) const {
+  return parameters_;
+}
+
+const algorithms::Apodizer& AnalysisContext::Window(void) const {
+  return apodizer_;
+}
+
+const algorithms::Apodizer& AnalysisContext::FrameWindow(void) const {
+  return frame_apodizer_;
+}
+
+const float* AnalysisContext::FrequencyScale(void) const {
+  return freq_scale_.Data();
+}
+
+const algorithms::KissFFTPlan& AnalysisContext::DftPlan(void) const {
+  return dft_plan_;
+}
+
+float AnalysisContext::SpectrumNormalization(void) const {
+  return spectrum_normalization_;
+}
+
+const algorithms::FilterBank& AnalysisContext::MelFilterBank(void) const {
+  return mel_filter_bank_;
+}
+
+const algorithms::FilterBank& AnalysisContext::BarkFilterBank(void) const {
+  return bark_filter_bank_;
+}
+
+const algorithms::Dct& AnalysisContext::MfccDct(void) const {
+  return mfcc_dct_;
+}
+
+const algorithms::OctaveBands& AnalysisContext::EnvelopeBands(void) const {
+  return envelope_bands_;
+}
+
+const algorithms::FlatnessBands&
+    AnalysisContext::SpectrumFlatnessBands(void) const {
+  return flatness_bands_;
+}
+
+const algorithms::ConstantQKernel&
+    AnalysisContext::ConstantQSpectralKernel(void) const {
+  return constant_q_kernel_;
+}
+
+}  // namespace interface
+}  // namespace chartreuse
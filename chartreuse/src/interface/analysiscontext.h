@@ -0,0 +1,114 @@
+/// @file analysiscontext.h
+/// @brief AnalysisContext class declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_INTERFACE_ANALYSISCONTEXT_H_
+#define CHARTREUSE_SRC_INTERFACE_ANALYSISCONTEXT_H_
+
+#include "chartreuse/src/common.h"
+
+#include "chartreuse/src/algorithms/apodizer.h"
+#include "chartreuse/src/algorithms/constantqkernel.h"
+#include "chartreuse/src/algorithms/dct.h"
+#include "chartreuse/src/algorithms/filterbank.h"
+#include "chartreuse/src/algorithms/kissfft.h"
+#include "chartreuse/src/algorithms/octavebands.h"
+#include "chartreuse/src/algorithms/scalegenerator.h"
+#include "chartreuse/src/algorithms/spectralflatness.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace interface {
+
+/// @brief Analysis context class:
+/// Hold all immutable data common to any manager using the same parameters
+/// (window, frequency scale, transform plan...)
+///
+/// It is built once and may then be shared between any number of managers,
+/// each of them only holding its own mutable state.
+/// Nothing here is modified after construction, hence managers sharing
+/// a context may run concurrently.
+class AnalysisContext {
+ public:
+  /// @brief Constructor: synthesizes all tables given the parameters
+  ///
+  /// @param[in]  parameters    Analysis parameters to use
+  explicit AnalysisContext(const Manager::Parameters& parameters);
+  ~AnalysisContext();
+
+  /// @brief Analysis parameters getter
+  const Manager::Parameters& AnalysisParameters(void) const;
+
+  /// @brief Retrieve the analysis window
+  const algorithms::Apodizer& Window(void) const;
+
+  /// @brief Retrieve the single frame window, for hop_size_sample
+  const algorithms::Apodizer& FrameWindow(void) const;
+
+  /// @brief Retrieve the frequency scale
+  const float* FrequencyScale(void) const;
+
+  /// @brief Retrieve the transform plan, for dft_length
+  const algorithms::KissFFTPlan& DftPlan(void) const;
+
+  /// @brief Retrieve the power spectrum normalization factor
+  float SpectrumNormalization(void) const;
+
+  /// @brief Retrieve the Mel filter bank, for dft_length
+  const algorithms::FilterBank& MelFilterBank(void) const;
+
+  /// @brief Retrieve the Bark filter bank, for dft_length
+  const algorithms::FilterBank& BarkFilterBank(void) const;
+
+  /// @brief Retrieve the transform from Mel bands to cepstral coefficients
+  const algorithms::Dct& MfccDct(void) const;
+
+  /// @brief Retrieve the spectrum envelope bands, for octave_resolution
+  const algorithms::OctaveBands& EnvelopeBands(void) const;
+
+  /// @brief Retrieve the spectrum flatness bands
+  const algorithms::FlatnessBands& SpectrumFlatnessBands(void) const;
+
+  /// @brief Retrieve the constant-Q transform spectral kernel
+  const algorithms::ConstantQKernel& ConstantQSpectralKernel(void) const;
+
+ private:
+  // No assignment operator for this class
+  AnalysisContext& operator=(const AnalysisContext& right);
+  // No copy constructor for this class
+  AnalysisContext(const AnalysisContext& right);
+
+  const Manager::Parameters parameters_;
+  const algorithms::Apodizer apodizer_;  ///< Window function application
+  const algorithms::Apodizer frame_apodizer_;  ///< Single frame window
+  const algorithms::ScaleGenerator freq_scale_;  ///< Frequency scale
+  const algorithms::KissFFTPlan dft_plan_;  ///< Transform plan
+  const float spectrum_normalization_;  ///< Power spectrum normalization
+  const algorithms::FilterBank mel_filter_bank_;  ///< Mel bands filters
+  const algorithms::FilterBank bark_filter_bank_;  ///< Bark bands filters
+  const algorithms::Dct mfcc_dct_;  ///< Mel bands to MFCC transform
+  const algorithms::OctaveBands envelope_bands_;  ///< Spectrum envelope bands
+  const algorithms::FlatnessBands flatness_bands_;  ///< Flatness bands
+  const algorithms::ConstantQKernel constant_q_kernel_;  ///< Constant-Q kernel
+};
+
+}  // namespace interface
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_INTERFACE_ANALYSISCONTEXT_H_
@@ -32,13 +32,13 @@ namespace chartreuse {
 namespace interface {
 
 Analyzer::Analyzer(const float sampling_freq)
-    : desc_manager_(*new Manager(Manager::Parameters(sampling_freq), true)),
+    : desc_manager_(new Manager(Manager::Parameters(sampling_freq), true)),
       buffer_(chartreuse::kHopSizeSamples) {
   // Nothing to do here for now
 }
 
 Analyzer::~Analyzer() {
-  delete &desc_manager_;
+  // Nothing to do here for now
 }
 
 unsigned int Analyzer::Process(const float* const input,
@@ -69,47 +69,43 @@ unsigned int Analyzer::Process(const float* const input,
   }
   float tmp_input[chartreuse::kHopSizeSamples];
   buffer_.Pop(&tmp_input[0], chartreuse::kHopSizeSamples);
-  desc_manager_.ProcessFrame(&tmp_input[0],
-                              chartreuse::kHopSizeSamples);
+  desc_manager_->ProcessFrame(&tmp_input[0],
+                               chartreuse::kHopSizeSamples);
   current_index += kCompletingCount;
   while (length - current_index >= chartreuse::kHopSizeSamples) {
-    for (unsigned int desc_idx(0);
-         desc_idx < kAvailableDescriptors.size();
-         ++desc_idx) {
-      const DescriptorId::Type current_descriptor(
-        kAvailableDescriptors[desc_idx]);
-      const float kRawValue(*desc_manager_.GetDescriptor(current_descriptor));
-      const descriptors::Descriptor_Meta& kMeta(desc_manager_.GetDescriptorMeta(
-                                                  current_descriptor));
-      // Normalization
-      *current_out = Normalize(kRawValue, kMeta.out_min, kMeta.out_max);
-      current_out += 1;
-    }
-    desc_manager_.ProcessFrame(&input[current_index],
-                               chartreuse::kHopSizeSamples);
+    RetrieveNormalized(desc_manager_.get(), current_out);
+    current_out += kAvailableDescriptorsCount;
+    desc_manager_->ProcessFrame(&input[current_index],
+                                chartreuse::kHopSizeSamples);
     current_index += chartreuse::kHopSizeSamples;
   }
-  for (unsigned int desc_idx(0);
-        desc_idx < kAvailableDescriptors.size();
-        ++desc_idx) {
-    const DescriptorId::Type current_descriptor(
-      kAvailableDescriptors[desc_idx]);
-    const float kRawValue(*desc_manager_.GetDescriptor(current_descriptor));
-    const descriptors::Descriptor_Meta& kMeta(desc_manager_.GetDescriptorMeta(
-                                                current_descriptor));
-    // Normalization
-    *current_out = Normalize(kRawValue, kMeta.out_min, kMeta.out_max);
-    current_out += 1;
-  }
+  RetrieveNormalized(desc_manager_.get(), current_out);
   CHARTREUSE_ASSERT(buffer_.Size() == 0);
   buffer_.Push(&input[current_index], length - current_index);
 
   return (current_index + kPoppedCount) / chartreuse::kHopSizeSamples;
 }
 
+void Analyzer::RetrieveNormalized(Manager* const manager,
+                                  float* const output) {
+  CHARTREUSE_ASSERT(manager != nullptr);
+  CHARTREUSE_ASSERT(output != nullptr);
+
+  for (unsigned int desc_idx(0);
+       desc_idx < kAvailableDescriptors.size();
+       ++desc_idx) {
+    const DescriptorId::Type current_descriptor(
+      kAvailableDescriptors[desc_idx]);
+    const float kRawValue(*manager->GetDescriptor(current_descriptor));
+    const descriptors::Descriptor_Meta& kMeta(
+      manager->GetDescriptorMeta(current_descriptor));
+    output[desc_idx] = Normalize(kRawValue, kMeta.out_min, kMeta.out_max);
+  }
+}
+
 float Analyzer::Normalize(const float input,
                           const float in_min,
-                          const float in_max) const {
+                          const float in_max) {
   return (input - in_min) / (in_max - in_min);
 }
 
@@ -22,6 +22,8 @@
 #define CHARTREUSE_SRC_INTERFACE_ANALYZER_H_
 
 #include <array>
+// std::unique_ptr
+#include <memory>
 
 #include "chartreuse/src/algorithms/ringbuffer.h"
 #include "chartreuse/src/interface/interface_common.h"
@@ -76,6 +78,13 @@ class Analyzer {
                        const unsigned int length,
                        float* const output);
 
+  /// @brief Retrieve all available descriptors for the frame the given
+  /// manager just processed, normalized the same way as Process() does
+  ///
+  /// @param[in]  manager   Descriptors manager
+  /// @param[out]  output   One value per available descriptor
+  static void RetrieveNormalized(Manager* const manager, float* const output);
+
  private:
 
   /// @brief Normalization helper method: wraps the normalization
@@ -84,11 +93,11 @@ class Analyzer {
   /// @param[in]  input   Input value
   /// @param[in]  in_min   Input lower bound
   /// @param[in]  in_max   Input higher bound
-   float Normalize(const float input,
-                   const float in_min,
-                   const float in_max) const;
+  static float Normalize(const float input,
+                         const float in_min,
+                         const float in_max);
 
-  Manager& desc_manager_;  ///< Audio descriptor manager
+  std::unique_ptr<Manager> desc_manager_;  ///< Audio descriptor manager
   algorithms::RingBuffer buffer_;  ///< Internal buffer for data framing
 };
 
@@ -0,0 +1,136 @@
+/// @file asyncanalyzer.cc
+/// @brief AsyncAnalyzer class implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/interface/asyncanalyzer.h"
+
+#include <array>
+
+#include "chartreuse/src/common.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace interface {
+
+AsyncAnalyzer::AsyncAnalyzer(const float sampling_freq,
+                             const unsigned int capacity)
+    : desc_manager_(new Manager(Manager::Parameters(sampling_freq), true)),
+      input_(capacity * chartreuse::kHopSizeSamples),
+      output_(capacity * kAvailableDescriptorsCount),
+      running_(true),
+      is_waiting_(false),
+      mutex_(),
+      wake_up_(),
+      worker_(&AsyncAnalyzer::Run, this) {
+  CHARTREUSE_ASSERT(capacity > 0);
+}
+
+AsyncAnalyzer::~AsyncAnalyzer() {
+  running_.store(false);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_up_.notify_one();
+  }
+  worker_.join();
+}
+
+bool AsyncAnalyzer::Push(const float* const input,
+                         const unsigned int length) {
+  CHARTREUSE_ASSERT(input != nullptr);
+  CHARTREUSE_ASSERT(length > 0);
+
+  if (!input_.Push(input, length)) {
+    return false;
+  }
+  WakeUp();
+  return true;
+}
+
+unsigned int AsyncAnalyzer::Retrieve(float* const output,
+                                     const unsigned int max_subframes) {
+  CHARTREUSE_ASSERT(output != nullptr);
+
+  unsigned int subframes_count(0);
+  while ((subframes_count < max_subframes)
+         && output_.Pop(&output[subframes_count * kAvailableDescriptorsCount],
+                        kAvailableDescriptorsCount)) {
+    subframes_count += 1;
+  }
+  // Room was made for the worker pending output
+  if (subframes_count > 0) {
+    WakeUp();
+  }
+  return subframes_count;
+}
+
+std::size_t AsyncAnalyzer::PendingSamples(void) const {
+  return input_.Size();
+}
+
+void AsyncAnalyzer::Run(void) {
+  std::array<float, chartreuse::kHopSizeSamples> frame;
+  std::array<float, kAvailableDescriptorsCount> descriptors_data;
+  bool has_pending_output(false);
+  while (running_.load()) {
+    if (!HasWork(has_pending_output)) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      is_waiting_.store(true);
+      // Pairs with the WakeUp() one: either the new queue state is seen
+      // below, or this worker is seen waiting there
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      wake_up_.wait(lock, [&] {
+        return !running_.load() || HasWork(has_pending_output);
+      });
+      is_waiting_.store(false);
+      continue;
+    }
+    // The previous subframe output has to be sent before processing the next
+    if (has_pending_output) {
+      has_pending_output = !output_.Push(&descriptors_data[0],
+                                         descriptors_data.size());
+      continue;
+    }
+    if (!input_.Pop(&frame[0], frame.size())) {
+      continue;
+    }
+    desc_manager_->ProcessFrame(&frame[0], frame.size());
+    Analyzer::RetrieveNormalized(desc_manager_.get(), &descriptors_data[0]);
+    has_pending_output = true;
+  }
+}
+
+bool AsyncAnalyzer::HasWork(const bool has_pending_output) const {
+  if (has_pending_output) {
+    return output_.Capacity() - output_.Size() >= kAvailableDescriptorsCount;
+  }
+  return input_.Size() >= chartreuse::kHopSizeSamples;
+}
+
+void AsyncAnalyzer::WakeUp(void) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  // The mutex is only taken here when the worker has to be notified,
+  // being released by the worker while it sleeps
+  if (is_waiting_.load()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_up_.notify_one();
+  }
+}
+
+}  // namespace interface
+}  // namespace chartreuse
@@ -0,0 +1,117 @@
+/// @file asyncanalyzer.h
+/// @brief AsyncAnalyzer class declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_INTERFACE_ASYNCANALYZER_H_
+#define CHARTREUSE_SRC_INTERFACE_ASYNCANALYZER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "chartreuse/src/algorithms/spscringbuffer.h"
+#include "chartreuse/src/interface/analyzer.h"
+
+namespace chartreuse {
+namespace interface {
+
+// Internal forward declaration
+class Manager;
+
+/// @brief Asynchronous Analyzer: real-time safe variant of the Analyzer,
+/// all descriptors computation being done in a dedicated worker thread
+///
+/// The caller (e.g. an audio callback) only copies its input into a
+/// lock-free queue, the worker processing it as soon as a whole hop is
+/// available; results are sent back through another lock-free queue.
+/// Output data is the same as the Analyzer one, one subframe at a time.
+/// @see kAvailableDescriptors
+///
+/// Any single thread may push input, and any single thread may retrieve
+/// output.
+///
+/// The worker sleeps on a condition variable while it has nothing to do:
+/// the caller only takes its mutex when the worker actually has to be woken
+/// up, and then never waits for any computation.
+class AsyncAnalyzer {
+ public:
+  /// @brief Constructor, starting the worker thread
+  ///
+  /// @param[in]  sampling_freq   Input signal sampling frequency
+  /// @param[in]  capacity   Input and output queues capacity, in subframes
+  explicit AsyncAnalyzer(const float sampling_freq,
+                         const unsigned int capacity);
+  /// @brief Destructor, stopping the worker thread
+  ~AsyncAnalyzer();
+
+  /// @brief Feed a frame whatever its length is - real-time safe
+  ///
+  /// @param[in]  input   Input frame data
+  /// @param[in]  length   Input frame length
+  ///
+  /// @return False if the input queue was full: the frame is then dropped
+  bool Push(const float* const input, const unsigned int length);
+
+  /// @brief Retrieve the descriptors of computed subframes - real-time safe
+  ///
+  /// @param[out]  output   Output data, in the same flattened structure as
+  /// the Analyzer one
+  /// @param[in]  max_subframes   Count of subframes output can hold
+  ///
+  /// @return Actual count of retrieved subframes
+  unsigned int Retrieve(float* const output,
+                        const unsigned int max_subframes);
+
+  /// @brief Count of input samples not processed yet
+  std::size_t PendingSamples(void) const;
+
+ private:
+  // No assignment operator for this class
+  AsyncAnalyzer& operator=(const AsyncAnalyzer& right);
+  // No copy constructor for this class
+  AsyncAnalyzer(const AsyncAnalyzer& right);
+
+  /// @brief Worker thread loop
+  void Run(void);
+
+  /// @brief Check if the worker may proceed - worker thread only
+  ///
+  /// @param[in]  has_pending_output   True if the last subframe output
+  /// still has to be sent
+  bool HasWork(const bool has_pending_output) const;
+
+  /// @brief Wake the worker up if it is sleeping, after any queue change
+  void WakeUp(void);
+
+  std::unique_ptr<Manager> desc_manager_;  ///< Audio descriptor manager
+  algorithms::SpscRingBuffer input_;  ///< Input samples queue
+  algorithms::SpscRingBuffer output_;  ///< Output descriptors queue
+  std::atomic<bool> running_;  ///< Set to false to stop the worker
+  std::atomic<bool> is_waiting_;  ///< Set by the worker before sleeping
+  std::mutex mutex_;  ///< Only guards the worker sleep
+  std::condition_variable wake_up_;  ///< Notified on queue changes
+  std::thread worker_;  ///< Has to be the last member, started last
+};
+
+}  // namespace interface
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_INTERFACE_ASYNCANALYZER_H_
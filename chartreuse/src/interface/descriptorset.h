@@ -0,0 +1,154 @@
+/// @file descriptorset.h
+/// @brief Compile-time descriptors set declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_INTERFACE_DESCRIPTORSET_H_
+#define CHARTREUSE_SRC_INTERFACE_DESCRIPTORSET_H_
+
+// std::copy_n
+#include <algorithm>
+// std::array
+#include <array>
+// std::size_t
+#include <cstddef>
+
+#include "chartreuse/src/common.h"
+
+#include "chartreuse/src/interface/interface_common.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace interface {
+
+/// @brief Check if the given descriptor is derived from the spectral moments
+constexpr bool IsMomentsBased(const DescriptorId::Type descriptor) {
+  return (descriptor == DescriptorId::kAudioSpectrumCentroid)
+      || (descriptor == DescriptorId::kAudioSpectrumSpread)
+      || (descriptor == DescriptorId::kAudioSpectrumSkewness)
+      || (descriptor == DescriptorId::kAudioSpectrumKurtosis)
+      || (descriptor == DescriptorId::kSpectralMoments);
+}
+
+/// @brief Compile-time check of a descriptors list properties
+template <DescriptorId::Type... Descriptors>
+struct DescriptorsTraits;
+
+template <>
+struct DescriptorsTraits<> {
+  static const bool kAnyMomentsBased = false;
+  static const bool kAllValid = true;
+};
+
+template <DescriptorId::Type First, DescriptorId::Type... Others>
+struct DescriptorsTraits<First, Others...> {
+  static const bool kAnyMomentsBased = IsMomentsBased(First)
+    || DescriptorsTraits<Others...>::kAnyMomentsBased;
+  static const bool kAllValid = (First < DescriptorId::kCount)
+    && DescriptorsTraits<Others...>::kAllValid;
+};
+
+/// @brief Descriptors set known at compile-time:
+/// generates a single per-hop function retrieving all of them
+///
+/// Descriptors retrieval is fully unrolled, in the given order, their data
+/// being packed into the output. Knowing the whole set allows shared
+/// intermediates to be computed by fused kernels: e.g. if any descriptor
+/// derived from the spectral moments is requested, these are computed first,
+/// along with the power spectrum in a single pass over the spectrum.
+template <DescriptorId::Type... Descriptors>
+class DescriptorSet {
+ public:
+  static_assert(sizeof...(Descriptors) > 0,
+                "A descriptors set cannot be empty");
+  static_assert(DescriptorsTraits<Descriptors...>::kAllValid,
+                "Invalid descriptor in the set");
+
+  /// @brief Constructor: enable all descriptors of the set
+  ///
+  /// @param[in]  manager    Manager in charge of the computation
+  explicit DescriptorSet(Manager* const manager)
+      : manager_(manager),
+        dims_(),
+        output_size_(0) {
+    CHARTREUSE_ASSERT(manager != nullptr);
+    const DescriptorId::Type kDescriptors[] = {Descriptors...};
+    for (unsigned int idx(0); idx < dims_.size(); ++idx) {
+      manager_->EnableDescriptor(kDescriptors[idx], true);
+      dims_[idx] = manager_->GetDescriptorMeta(kDescriptors[idx]).out_dim;
+      output_size_ += dims_[idx];
+    }
+  }
+
+  /// @brief Per-hop function: process the given frame and retrieve
+  /// all descriptors
+  ///
+  /// @param[in]  frame    Frame to be analysed
+  /// @param[in]  frame_length    Input frame length
+  /// @param[out]  output    Packed descriptors data, of OutputSize()
+  void Process(const float* const frame,
+               const std::size_t frame_length,
+               float* const output) {
+    CHARTREUSE_ASSERT(output != nullptr);
+    manager_->ProcessFrame(frame, frame_length);
+    // Moments-based descriptors are gated: nothing to prepare on silence
+    if (DescriptorsTraits<Descriptors...>::kAnyMomentsBased
+        && !manager_->IsSilent()) {
+      manager_->GetDescriptor(DescriptorId::kSpectralMoments);
+    }
+    float* current_out(output);
+    unsigned int idx(0);
+    // Unrolled retrieval, in the given order
+    const int kExpansion[] = {
+      0,
+      (current_out = Retrieve(Descriptors, dims_[idx++], current_out), 0)...
+    };
+    static_cast<void>(kExpansion);
+  }
+
+  /// @brief Total length of all descriptors data
+  std::size_t OutputSize(void) const {
+    return output_size_;
+  }
+
+ private:
+  // No assignment operator for this class
+  DescriptorSet& operator=(const DescriptorSet& right);
+  // No copy constructor for this class
+  DescriptorSet(const DescriptorSet& right);
+
+  /// @brief Copy the given descriptor data into the output
+  ///
+  /// @return The output position for the next descriptor
+  float* Retrieve(const DescriptorId::Type descriptor,
+                  const unsigned int dim,
+                  float* const output) {
+    std::copy_n(manager_->GetDescriptor(descriptor), dim, output);
+    return output + dim;
+  }
+
+  Manager* const manager_;
+  /// Each descriptor output dimension, in the set order
+  std::array<unsigned int, sizeof...(Descriptors)> dims_;
+  std::size_t output_size_;
+};
+
+}  // namespace interface
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_INTERFACE_DESCRIPTORSET_H_
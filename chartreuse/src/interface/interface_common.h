@@ -34,11 +34,32 @@ enum Type {
   kAudioWaveform,
   kAudioFundamentalFrequency,
   kAudioHarmonicity,
+  kAudioSpectrumSkewness,
+  kAudioSpectrumKurtosis,
+  kMelBands,
+  kBarkBands,
+  kMFCC,
+  kAudioSpectrumEnvelope,
+  kAudioSpectrumFlatness,
+  kAudioUpperLimitOfHarmonicity,
+  kHarmonicSpectralCentroid,
+  kHarmonicSpectralDeviation,
+  kHarmonicSpectralSpread,
+  kHarmonicSpectralVariation,
+  kConstantQ,
+  kOnsetStrength,
+  kSignalEnvelope,
+  kLogAttackTime,
+  kTemporalCentroid,
+  kPitchTrack,
   kDft,
   kSpectrogram,
   kDftPower,
   kSpectrogramPower,
   kAutoCorrelation,
+  kSpectralMoments,
+  kHarmonicPeaks,
+  kNormalizedDifference,
   kCount
 };
 
@@ -50,6 +71,28 @@ static inline Type operator++(const Type value) {
 
 }  // namespace DescriptorId
 
+namespace PitchEstimator {
+
+/// @brief Available fundamental frequency estimation methods
+enum Type {
+  kAutoCorrelation = 0,  ///< Normalized autocorrelation peak picking
+  kYin,  ///< Cumulative mean normalized difference (YIN)
+  kCount
+};
+
+}  // namespace PitchEstimator
+
+namespace Framing {
+
+/// @brief Where overlapped data windows are built from input frames
+enum Type {
+  kInternal = 0,  ///< By the manager itself, from successive frames
+  kExternal,  ///< By the caller, windows being given to the manager
+  kCount
+};
+
+}  // namespace Framing
+
 }  // namespace interface
 }  // namespace chartreuse
 
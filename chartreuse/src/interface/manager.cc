@@ -20,23 +20,51 @@
 
 #include "chartreuse/src/interface/manager.h"
 
-// std::copy_n
+// std::copy_n, std::fill, std::max, std::min
 #include <algorithm>
 // std::floor
 #include <cmath>
 
 #include "chartreuse/src/algorithms/algorithms_common.h"
 #include "chartreuse/src/descriptors/descriptor_interface.h"
+#include "chartreuse/src/interface/analysiscontext.h"
 
 namespace chartreuse {
 namespace interface {
 
+/// @brief Number of past spectra held, as required by OnsetStrength
+static const unsigned int kSpectrumHistoryDepth(2);
+
+/// @brief Scratch memory size, in floats
+///
+/// Descriptors never borrow while another descriptor scope is open
+/// (their inputs are retrieved beforehand), hence the largest single
+/// borrowing is enough: NormalizedDifference and
+/// AudioUpperLimitOfHarmonicity are the most demanding ones,
+/// all others borrowing less than a Dft-sized buffer.
+static std::size_t WorkspaceCapacity(const unsigned int dft_length) {
+  using algorithms::Workspace;
+  // Zero-padded input, two transforms and transform scratch
+  const std::size_t kNormalizedDifference(
+    2 * Workspace::BlockLength(dft_length)
+    + 2 * Workspace::BlockLength(dft_length + 2));
+  // Windowed frame, transform scratch, its transform and both powers
+  const std::size_t kUpperLimitOfHarmonicity(
+    2 * Workspace::BlockLength(dft_length + 2)
+    + Workspace::BlockLength(dft_length)
+    + 2 * Workspace::BlockLength(dft_length / 2 + 1));
+  return std::max(kNormalizedDifference, kUpperLimitOfHarmonicity);
+}
+
 Manager::Parameters::Parameters(const float sampling_freq,
                                 const unsigned int dft_length,
                                 const float low_freq,
                                 const float high_freq,
                                 const unsigned int hop_size_sample,
-                                const unsigned int overlap)
+                                const unsigned int overlap,
+                                const float octave_resolution,
+                                const PitchEstimator::Type pitch_estimator,
+                                const float silence_threshold)
     : sampling_freq(sampling_freq),
       dft_length(dft_length),
       low_freq(low_freq),
@@ -48,7 +76,10 @@ Manager::Parameters::Parameters(const float sampling_freq,
       max_lag(static_cast<unsigned int>(std::floor(sampling_freq / low_freq))),
       hop_size_sample(hop_size_sample),
       overlap(overlap),
-      window_length(hop_size_sample * overlap) {
+      window_length(hop_size_sample * overlap),
+      octave_resolution(octave_resolution),
+      pitch_estimator(pitch_estimator),
+      silence_threshold(silence_threshold) {
   CHARTREUSE_ASSERT(sampling_freq > 0.0f);
   CHARTREUSE_ASSERT(dft_length > 0);
   CHARTREUSE_ASSERT(algorithms::IsPowerOfTwo(dft_length));
@@ -67,43 +98,82 @@ Manager::Parameters::Parameters(const float sampling_freq,
   CHARTREUSE_ASSERT(overlap >= 1);
   CHARTREUSE_ASSERT(window_length > 0);
   CHARTREUSE_ASSERT(window_length >= hop_size_sample);
+  // MPEG-7 allowed resolutions
+  CHARTREUSE_ASSERT(octave_resolution >= 1.0f / 16.0f);
+  CHARTREUSE_ASSERT(octave_resolution <= 8.0f);
+  CHARTREUSE_ASSERT(pitch_estimator != PitchEstimator::kCount);
+  CHARTREUSE_ASSERT(silence_threshold >= 0.0f);
 }
 
-Manager::Manager(const Parameters& parameters, const bool zero_init)
+Manager::Manager(const Parameters& parameters,
+                 const bool zero_init,
+                 const Framing::Type framing)
+    : Manager(std::make_shared<const AnalysisContext>(parameters),
+              zero_init,
+              framing) {
+  // Nothing to do here for now
+}
+
+Manager::Manager(const std::shared_ptr<const AnalysisContext>& context,
+                 const bool zero_init,
+                 const Framing::Type framing)
     : enabled_descriptors_(),
       computed_descriptors_(),
+      gate_hits_(),
       descriptors_data_(),
-      current_frame_(parameters.hop_size_sample),
-      current_window_(parameters.dft_length),
-      current_window_apodized_(parameters.dft_length),
-      parameters_(parameters),
+      current_frame_(context->AnalysisParameters().hop_size_sample),
+      current_window_((framing == Framing::kInternal)
+                      ? context->AnalysisParameters().dft_length
+                      : 0),
+      window_(nullptr),
+      current_window_apodized_(context->AnalysisParameters().dft_length),
+      context_(context),
+      zero_init_(zero_init),
+      workspace_(WorkspaceCapacity(context->AnalysisParameters().dft_length)),
       audio_power_(this),
       audio_spectrum_centroid_(this),
       audio_spectrum_spread_(this),
       audio_waveform_(this),
       audio_fundamental_frequency_(this),
       audio_harmonicity_(this),
-      ringbuf_(parameters.window_length),
+      audio_spectrum_skewness_(this),
+      audio_spectrum_kurtosis_(this),
+      mel_bands_(this),
+      bark_bands_(this),
+      mfcc_(this),
+      audio_spectrum_envelope_(this),
+      audio_spectrum_flatness_(this),
+      audio_upper_limit_of_harmonicity_(this),
+      harmonic_spectral_centroid_(this),
+      harmonic_spectral_deviation_(this),
+      harmonic_spectral_spread_(this),
+      harmonic_spectral_variation_(this),
+      constant_q_(this),
+      onset_strength_(this),
+      signal_envelope_(this),
+      log_attack_time_(this),
+      temporal_centroid_(this),
+      pitch_track_(this),
+      ringbuf_((framing == Framing::kInternal)
+               ? new algorithms::RingBuffer(
+                   context->AnalysisParameters().window_length)
+               : nullptr),
       autocorrelation_(this),
       dft_(this),
       spectrogram_(this),
       dft_power_(this),
       spectrogram_power_(this),
-      apodizer_(parameters.dft_length, algorithms::Window::kHamming),
-      freq_scale_(parameters.high_edge - parameters.low_edge,
-                  algorithms::Scale::kLogFreq,
-                  parameters.dft_length,
-                  parameters.sampling_freq) {
-  // TODO(gm): Find a cleaner way to do this
+      spectral_moments_(this),
+      harmonic_peaks_(this),
+      normalized_difference_(this),
+      spectrum_history_(context->AnalysisParameters().dft_length / 2 + 1,
+                        kSpectrumHistoryDepth) {
+  CHARTREUSE_ASSERT(framing != Framing::kCount);
+  if (framing == Framing::kInternal) {
+    window_ = &current_window_[0];
+  }
   if (zero_init) {
-    // The first input buffer is to be considered as the "future" part
-    // in the overlap.
-    // Hence, the first 2 parts ("past" and "present") have to be filled in order
-    // for the internal buffer writing cursor to be at the right position
-    // TODO(gm): Find a better way using an "overlap" parameter to do this
-    ringbuf_.Fill(0.0f,
-                  parameters.window_length * (parameters.overlap - 1)
-                  / parameters.overlap);
+    ZeroInit();
   }
   // TODO(gm): this could be computed at compile-time
   unsigned int desc_data_size(0);
@@ -113,38 +183,81 @@ Manager::Manager(const Parameters& parameters, const bool zero_init)
   descriptors_data_.resize(desc_data_size);
   enabled_descriptors_.fill(false);
   computed_descriptors_.fill(false);
+  gate_hits_.fill(0);
 }
 
 Manager::~Manager() {
   // Nothing to do here for now
 }
 
+std::unique_ptr<Manager> Manager::Clone(void) const {
+  std::unique_ptr<Manager> clone(new Manager(context_, false, FramingType()));
+  clone->CopyState(*this);
+  return clone;
+}
+
+void Manager::Reset(void) {
+  enabled_descriptors_.fill(false);
+  computed_descriptors_.fill(false);
+  gate_hits_.fill(0);
+  // Gated descriptors may hold their previous output
+  std::fill(descriptors_data_.begin(), descriptors_data_.end(), 0.0f);
+  std::fill(current_frame_.begin(), current_frame_.end(), 0.0f);
+  std::fill(current_window_.begin(), current_window_.end(), 0.0f);
+  std::fill(current_window_apodized_.begin(),
+            current_window_apodized_.end(),
+            0.0f);
+  if (FramingType() == Framing::kInternal) {
+    ringbuf_->Clear();
+    window_ = &current_window_[0];
+  } else {
+    // No window until the next one is given
+    window_ = nullptr;
+  }
+  if (zero_init_) {
+    ZeroInit();
+  }
+  spectrum_history_.Reset();
+  for (unsigned int desc_idx(0); desc_idx < DescriptorId::kCount; ++desc_idx) {
+    DescriptorInstance(static_cast<DescriptorId::Type>(desc_idx))->Reset();
+  }
+}
+
 void Manager::ProcessFrame(const float* const frame,
                            const std::size_t frame_length) {
   CHARTREUSE_ASSERT(frame != nullptr);
   CHARTREUSE_ASSERT(frame_length > 0);
 
-  // Invalidate all computation from the previous frame
-  for (unsigned int descriptor_idx(0);
-       descriptor_idx < DescriptorId::kCount;
-       ++descriptor_idx) {
-    DescriptorIsComputed(static_cast<DescriptorId::Type>(descriptor_idx),
-                         false);
-  }
-  // Push the frame into internal scratch memory
-  // TODO(gm): no resizing should occur here
-  current_frame_.resize(frame_length);
-  std::copy_n(frame, frame_length, current_frame_.begin());
+  CHARTREUSE_ASSERT(FramingType() == Framing::kInternal);
+
+  BeginFrame(frame, frame_length);
   // Push into ringbuffer for overlap
-  ringbuf_.Push(frame, frame_length);
+  ringbuf_->Push(frame, frame_length);
   // Pop - zero-padding done in the ringbuffer method
-  ringbuf_.PopOverlapped(&current_window_[0],
-                         parameters_.dft_length,
-                         parameters_.overlap);
-  std::copy_n(current_window_.begin(),
-              current_window_.size(),
-              current_window_apodized_.begin());
-  apodizer_.ApplyWindow(&current_window_apodized_[0]);
+  ringbuf_->PopOverlapped(&current_window_[0],
+                         AnalysisParameters().dft_length,
+                         AnalysisParameters().overlap);
+  window_ = &current_window_[0];
+  EndFrame();
+}
+
+void Manager::ProcessWindow(const float* const frame,
+                            const std::size_t frame_length,
+                            const float* const window) {
+  CHARTREUSE_ASSERT(frame != nullptr);
+  CHARTREUSE_ASSERT(frame_length > 0);
+  CHARTREUSE_ASSERT(window != nullptr);
+
+  CHARTREUSE_ASSERT(FramingType() == Framing::kExternal);
+
+  BeginFrame(frame, frame_length);
+  window_ = window;
+  EndFrame();
+}
+
+void Manager::StartSegment(void) {
+  log_attack_time_.Reset();
+  temporal_centroid_.Reset();
 }
 
 void Manager::EnableDescriptor(const DescriptorId::Type descriptor,
@@ -156,71 +269,217 @@ void Manager::EnableDescriptor(const DescriptorId::Type descriptor,
 const float* Manager::GetDescriptor(const DescriptorId::Type descriptor) {
   // TODO(gm): this cast is ugly, remove it
   float* const internal_data_ptr(DescriptorDataPtr(descriptor));
-  descriptors::Descriptor_Interface* instance(nullptr);
   if (!IsDescriptorComputed(descriptor)) {
-    // TODO(gm): a cleaner code!
-    switch (descriptor) {
-      case DescriptorId::kAudioPower: {
-          instance = &audio_power_;
-          break;
-        }
-      case DescriptorId::kAudioSpectrumCentroid: {
-          instance = &audio_spectrum_centroid_;
-          break;
-        }
-      case DescriptorId::kAudioSpectrumSpread: {
-          instance = &audio_spectrum_spread_;
-          break;
-        }
-      case DescriptorId::kAudioWaveform: {
-          instance = &audio_waveform_;
-          break;
-        }
-      case DescriptorId::kAudioFundamentalFrequency: {
-          instance = &audio_fundamental_frequency_;
-          break;
-        }
-      case DescriptorId::kAudioHarmonicity: {
-          instance = &audio_harmonicity_;
-          break;
-        }
-      case DescriptorId::kDft: {
-          instance = &dft_;
-          break;
-        }
-      case DescriptorId::kSpectrogram: {
-          instance = &spectrogram_;
-          break;
-        }
-      case DescriptorId::kDftPower: {
-          instance = &dft_power_;
-          break;
-        }
-      case DescriptorId::kSpectrogramPower: {
-          instance = &spectrogram_power_;
-          break;
-        }
-      case DescriptorId::kAutoCorrelation: {
-          instance = &autocorrelation_;
-          break;
-        }
-      case DescriptorId::kCount:
-      default: {
-          // Should never happen
-          CHARTREUSE_ASSERT(false);
-          break;
-        }
-    }  // switch (descriptor)
-    CHARTREUSE_ASSERT(instance != nullptr);
-    instance->operator()(internal_data_ptr);
+    descriptors::Descriptor_Interface* const instance(
+      DescriptorInstance(descriptor));
+    // Only gated descriptors trigger the gate evaluation (AudioPower)
+    if (instance->IsGated() && IsSilent()) {
+      instance->Silence(internal_data_ptr);
+      gate_hits_[descriptor] += 1;
+    } else {
+      instance->operator()(internal_data_ptr);
+    }
     DescriptorIsComputed(descriptor, true);
   }
   return internal_data_ptr;
 }
 
+float* Manager::ProvideDescriptor(const DescriptorId::Type descriptor) {
+  CHARTREUSE_ASSERT(descriptor != DescriptorId::kCount);
+  CHARTREUSE_ASSERT(!IsDescriptorComputed(descriptor));
+  DescriptorIsComputed(descriptor, true);
+  return DescriptorDataPtr(descriptor);
+}
+
 descriptors::Descriptor_Meta Manager::GetDescriptorMeta(
     const DescriptorId::Type descriptor) const {
-  // TODO(gm): a cleaner code!
+  return DescriptorInstance(descriptor)->Meta();
+}
+
+bool Manager::IsSilent(void) {
+  const float kThreshold(AnalysisParameters().silence_threshold);
+  if (kThreshold <= 0.0f) {
+    return false;
+  }
+  return *GetDescriptor(DescriptorId::kAudioPower) < kThreshold;
+}
+
+unsigned int Manager::GateHitCount(const DescriptorId::Type descriptor) const {
+  CHARTREUSE_ASSERT(descriptor != DescriptorId::kCount);
+  return gate_hits_[descriptor];
+}
+
+std::size_t Manager::DescriptorsOutputSize(void) const {
+  std::size_t out(0);
+  DescriptorId::Type current_id(DescriptorId::kAudioPower);
+  for (const bool enabled_descriptor : enabled_descriptors_) {
+    if(enabled_descriptor) {
+      out += GetDescriptorMeta(current_id).out_dim;
+    }  // for (const bool enabled_descriptor : enabled_descriptors_)
+    current_id = static_cast<DescriptorId::Type>(++current_id);
+  }
+  return out;
+}
+
+const Manager::Parameters& Manager::AnalysisParameters(void) const {
+  return context_->AnalysisParameters();
+}
+
+const AnalysisContext& Manager::Context(void) const {
+  return *context_;
+}
+
+const std::shared_ptr<const AnalysisContext>& Manager::SharedContext(void) const {
+  return context_;
+}
+
+const float* Manager::CurrentFrame(void) const {
+  return &current_frame_[0];
+}
+
+const float* Manager::CurrentWindow(void) const {
+  CHARTREUSE_ASSERT(window_ != nullptr);
+  return window_;
+}
+
+const float* Manager::CurrentWindowApodized(void) const {
+  return &current_window_apodized_[0];
+}
+
+const float* Manager::FrequencyScale(void) const {
+  return context_->FrequencyScale();
+}
+
+algorithms::SpectrumHistory& Manager::PastSpectra(void) {
+  return spectrum_history_;
+}
+
+algorithms::Workspace& Manager::Scratch(void) {
+  return workspace_;
+}
+
+void Manager::CopyState(const Manager& other) {
+  CHARTREUSE_ASSERT(context_ == other.context_);
+  enabled_descriptors_ = other.enabled_descriptors_;
+  computed_descriptors_ = other.computed_descriptors_;
+  gate_hits_ = other.gate_hits_;
+  // Same lengths: no reallocation here
+  descriptors_data_ = other.descriptors_data_;
+  current_frame_ = other.current_frame_;
+  CHARTREUSE_ASSERT(FramingType() == other.FramingType());
+  current_window_ = other.current_window_;
+  // An external window is shared, as done by the other instance
+  window_ = (other.FramingType() == Framing::kInternal)
+    ? &current_window_[0]
+    : other.window_;
+  current_window_apodized_ = other.current_window_apodized_;
+  if (FramingType() == Framing::kInternal) {
+    ringbuf_->CopyState(*other.ringbuf_);
+  }
+  spectrum_history_.CopyState(other.spectrum_history_);
+  for (unsigned int desc_idx(0); desc_idx < DescriptorId::kCount; ++desc_idx) {
+    const DescriptorId::Type kDescriptor(
+      static_cast<DescriptorId::Type>(desc_idx));
+    DescriptorInstance(kDescriptor)->CopyState(
+      *other.DescriptorInstance(kDescriptor));
+  }
+}
+
+Framing::Type Manager::FramingType(void) const {
+  return (ringbuf_ != nullptr) ? Framing::kInternal : Framing::kExternal;
+}
+
+void Manager::ZeroInit(void) {
+  if (FramingType() == Framing::kExternal) {
+    // Nothing to fill, the caller is in charge of the past signal
+    return;
+  }
+  const Parameters& parameters(AnalysisParameters());
+  // TODO(gm): Find a cleaner way to do this
+  // The first input buffer is to be considered as the "future" part
+  // in the overlap.
+  // Hence, the first 2 parts ("past" and "present") have to be filled in order
+  // for the internal buffer writing cursor to be at the right position
+  // TODO(gm): Find a better way using an "overlap" parameter to do this
+  ringbuf_->Fill(0.0f,
+                 parameters.window_length * (parameters.overlap - 1)
+                 / parameters.overlap);
+}
+
+void Manager::BeginFrame(const float* const frame,
+                         const std::size_t frame_length) {
+  // Save the spectrum of the frame being left, if anyone needs it:
+  // only if computed at its end, the window may not be valid anymore
+  if (spectrum_history_.IsActive()
+      && IsDescriptorComputed(DescriptorId::kDft)) {
+    spectrum_history_.Push(GetDescriptor(DescriptorId::kDft));
+  }
+  // Invalidate all computation from the previous frame
+  for (unsigned int descriptor_idx(0);
+       descriptor_idx < DescriptorId::kCount;
+       ++descriptor_idx) {
+    DescriptorIsComputed(static_cast<DescriptorId::Type>(descriptor_idx),
+                         false);
+  }
+  // Push the frame into internal scratch memory:
+  // never larger than its initial size, hence no allocation here
+  CHARTREUSE_ASSERT(frame_length <= AnalysisParameters().hop_size_sample);
+  current_frame_.resize(frame_length);
+  std::copy_n(frame, frame_length, current_frame_.begin());
+}
+
+void Manager::EndFrame(void) {
+  // Single pass from the current window, zero-padded
+  const Parameters& parameters(AnalysisParameters());
+  context_->Window().ApplyWindow(window_,
+                                 std::min(parameters.window_length,
+                                          parameters.dft_length),
+                                 &current_window_apodized_[0]);
+  // The window may be external: its spectrum has to be retrieved
+  // for the history while it is still valid
+  if (spectrum_history_.IsActive()) {
+    GetDescriptor(DescriptorId::kDft);
+  }
+  // Stateful descriptors have to see every frame, retrieved or not
+  for (unsigned int desc_idx(0); desc_idx < DescriptorId::kCount; ++desc_idx) {
+    const DescriptorId::Type kDescriptor(
+      static_cast<DescriptorId::Type>(desc_idx));
+    if (enabled_descriptors_[kDescriptor]
+        && DescriptorInstance(kDescriptor)->IsStateful()) {
+      GetDescriptor(kDescriptor);
+    }
+  }
+}
+
+bool Manager::IsDescriptorComputed(const DescriptorId::Type descriptor) const {
+  return computed_descriptors_[static_cast<int>(descriptor)];
+}
+
+void Manager::DescriptorIsComputed(const DescriptorId::Type descriptor,
+                                   const bool is_computed) {
+  computed_descriptors_[static_cast<int>(descriptor)] = is_computed;
+}
+
+float* Manager::DescriptorDataPtr(const DescriptorId::Type descriptor) {
+  DescriptorId::Type current_id(DescriptorId::kAudioPower);
+  std::size_t data_offset(0);
+  while (current_id != descriptor) {
+    data_offset += DescriptorInstance(current_id)->Meta().out_dim;
+    current_id = static_cast<DescriptorId::Type>(++current_id);
+  }  // while (current_id != descriptor)
+  CHARTREUSE_ASSERT(data_offset < descriptors_data_.size());
+  return &descriptors_data_[0] + data_offset;
+}
+
+descriptors::Descriptor_Interface* Manager::DescriptorInstance(
+    const DescriptorId::Type descriptor) {
+  return const_cast<descriptors::Descriptor_Interface*>(
+    static_cast<const Manager*>(this)->DescriptorInstance(descriptor));
+}
+
+const descriptors::Descriptor_Interface* Manager::DescriptorInstance(
+    const DescriptorId::Type descriptor) const {
+  // TODO(gm): use a smarter factory
   const descriptors::Descriptor_Interface* instance(nullptr);
   switch (descriptor) {
     case DescriptorId::kAudioPower: {
@@ -247,6 +506,78 @@ descriptors::Descriptor_Meta Manager::GetDescriptorMeta(
         instance = &audio_harmonicity_;
         break;
       }
+    case DescriptorId::kAudioSpectrumSkewness: {
+        instance = &audio_spectrum_skewness_;
+        break;
+      }
+    case DescriptorId::kAudioSpectrumKurtosis: {
+        instance = &audio_spectrum_kurtosis_;
+        break;
+      }
+    case DescriptorId::kMelBands: {
+        instance = &mel_bands_;
+        break;
+      }
+    case DescriptorId::kBarkBands: {
+        instance = &bark_bands_;
+        break;
+      }
+    case DescriptorId::kMFCC: {
+        instance = &mfcc_;
+        break;
+      }
+    case DescriptorId::kAudioSpectrumEnvelope: {
+        instance = &audio_spectrum_envelope_;
+        break;
+      }
+    case DescriptorId::kAudioSpectrumFlatness: {
+        instance = &audio_spectrum_flatness_;
+        break;
+      }
+    case DescriptorId::kAudioUpperLimitOfHarmonicity: {
+        instance = &audio_upper_limit_of_harmonicity_;
+        break;
+      }
+    case DescriptorId::kHarmonicSpectralCentroid: {
+        instance = &harmonic_spectral_centroid_;
+        break;
+      }
+    case DescriptorId::kHarmonicSpectralDeviation: {
+        instance = &harmonic_spectral_deviation_;
+        break;
+      }
+    case DescriptorId::kHarmonicSpectralSpread: {
+        instance = &harmonic_spectral_spread_;
+        break;
+      }
+    case DescriptorId::kHarmonicSpectralVariation: {
+        instance = &harmonic_spectral_variation_;
+        break;
+      }
+    case DescriptorId::kConstantQ: {
+        instance = &constant_q_;
+        break;
+      }
+    case DescriptorId::kOnsetStrength: {
+        instance = &onset_strength_;
+        break;
+      }
+    case DescriptorId::kSignalEnvelope: {
+        instance = &signal_envelope_;
+        break;
+      }
+    case DescriptorId::kLogAttackTime: {
+        instance = &log_attack_time_;
+        break;
+      }
+    case DescriptorId::kTemporalCentroid: {
+        instance = &temporal_centroid_;
+        break;
+      }
+    case DescriptorId::kPitchTrack: {
+        instance = &pitch_track_;
+        break;
+      }
     case DescriptorId::kDft: {
         instance = &dft_;
         break;
@@ -267,6 +598,18 @@ descriptors::Descriptor_Meta Manager::GetDescriptorMeta(
         instance = &autocorrelation_;
         break;
       }
+    case DescriptorId::kSpectralMoments: {
+        instance = &spectral_moments_;
+        break;
+      }
+    case DescriptorId::kHarmonicPeaks: {
+        instance = &harmonic_peaks_;
+        break;
+      }
+    case DescriptorId::kNormalizedDifference: {
+        instance = &normalized_difference_;
+        break;
+      }
     case DescriptorId::kCount:
     default: {
         // Should never happen
@@ -275,113 +618,7 @@ descriptors::Descriptor_Meta Manager::GetDescriptorMeta(
       }
   }  // switch (descriptor)
   CHARTREUSE_ASSERT(instance != nullptr);
-  return instance->Meta();
-}
-
-std::size_t Manager::DescriptorsOutputSize(void) const {
-  std::size_t out(0);
-  DescriptorId::Type current_id(DescriptorId::kAudioPower);
-  for (const bool enabled_descriptor : enabled_descriptors_) {
-    if(enabled_descriptor) {
-      out += GetDescriptorMeta(current_id).out_dim;
-    }  // for (const bool enabled_descriptor : enabled_descriptors_)
-    current_id = static_cast<DescriptorId::Type>(++current_id);
-  }
-  return out;
-}
-
-const Manager::Parameters& Manager::AnalysisParameters(void) const {
-  return parameters_;
-}
-
-const float* Manager::CurrentFrame(void) const {
-  return &current_frame_[0];
-}
-
-const float* Manager::CurrentWindow(void) const {
-  return &current_window_[0];
-}
-
-const float* Manager::CurrentWindowApodized(void) const {
-  return &current_window_apodized_[0];
-}
-
-const float* Manager::FrequencyScale(void) const {
-  return freq_scale_.Data();
-}
-
-bool Manager::IsDescriptorComputed(const DescriptorId::Type descriptor) const {
-  return computed_descriptors_[static_cast<int>(descriptor)];
-}
-
-void Manager::DescriptorIsComputed(const DescriptorId::Type descriptor,
-                                   const bool is_computed) {
-  computed_descriptors_[static_cast<int>(descriptor)] = is_computed;
-}
-
-float* Manager::DescriptorDataPtr(const DescriptorId::Type descriptor) {
-  DescriptorId::Type current_id(DescriptorId::kAudioPower);
-  std::size_t data_offset(0);
-  while (current_id != descriptor) {
-    const descriptors::Descriptor_Interface* instance(nullptr);
-    switch (current_id) {
-      case DescriptorId::kAudioPower: {
-          instance = &audio_power_;
-          break;
-        }
-      case DescriptorId::kAudioSpectrumCentroid: {
-          instance = &audio_spectrum_centroid_;
-          break;
-        }
-      case DescriptorId::kAudioSpectrumSpread: {
-          instance = &audio_spectrum_spread_;
-          break;
-        }
-      case DescriptorId::kAudioWaveform: {
-          instance = &audio_waveform_;
-          break;
-        }
-      case DescriptorId::kAudioFundamentalFrequency: {
-          instance = &audio_fundamental_frequency_;
-          break;
-        }
-      case DescriptorId::kAudioHarmonicity: {
-          instance = &audio_harmonicity_;
-          break;
-        }
-      case DescriptorId::kDft: {
-          instance = &dft_;
-          break;
-        }
-      case DescriptorId::kSpectrogram: {
-          instance = &spectrogram_;
-          break;
-        }
-      case DescriptorId::kDftPower: {
-          instance = &dft_power_;
-          break;
-        }
-      case DescriptorId::kSpectrogramPower: {
-          instance = &spectrogram_power_;
-          break;
-        }
-      case DescriptorId::kAutoCorrelation: {
-          instance = &autocorrelation_;
-          break;
-        }
-      case DescriptorId::kCount:
-      default: {
-          // Should never happen
-          CHARTREUSE_ASSERT(false);
-          break;
-        }
-    }  // switch (descriptor)
-    CHARTREUSE_ASSERT(instance != nullptr);
-    data_offset += instance->Meta().out_dim;
-    current_id = static_cast<DescriptorId::Type>(++current_id);
-  }  // while (current_id != descriptor)
-  CHARTREUSE_ASSERT(data_offset < descriptors_data_.size());
-  return &descriptors_data_[0] + data_offset;
+  return instance;
 }
 
 }  // namespace interface
@@ -22,34 +22,64 @@
 #define CHARTREUSE_SRC_INTERFACE_MANAGER_H_
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "chartreuse/src/common.h"
 
-#include "chartreuse/src/algorithms/apodizer.h"
 #include "chartreuse/src/algorithms/autocorrelation.h"
 #include "chartreuse/src/algorithms/dftpower.h"
+#include "chartreuse/src/algorithms/harmonicpeaks.h"
 #include "chartreuse/src/algorithms/kissfft.h"
+#include "chartreuse/src/algorithms/normalizeddifference.h"
 #include "chartreuse/src/algorithms/ringbuffer.h"
-#include "chartreuse/src/algorithms/scalegenerator.h"
+#include "chartreuse/src/algorithms/spectralmoments.h"
 #include "chartreuse/src/algorithms/spectrogram.h"
 #include "chartreuse/src/algorithms/spectrogrampower.h"
+#include "chartreuse/src/algorithms/spectrumhistory.h"
+#include "chartreuse/src/algorithms/workspace.h"
 
 #include "chartreuse/src/descriptors/audiofundamentalfrequency.h"
 #include "chartreuse/src/descriptors/audioharmonicity.h"
 #include "chartreuse/src/descriptors/audiopower.h"
 #include "chartreuse/src/descriptors/audiospectrumcentroid.h"
+#include "chartreuse/src/descriptors/audiospectrumenvelope.h"
+#include "chartreuse/src/descriptors/audiospectrumflatness.h"
+#include "chartreuse/src/descriptors/audiospectrumkurtosis.h"
+#include "chartreuse/src/descriptors/audiospectrumskewness.h"
 #include "chartreuse/src/descriptors/audiospectrumspread.h"
+#include "chartreuse/src/descriptors/audioupperlimitofharmonicity.h"
 #include "chartreuse/src/descriptors/audiowaveform.h"
+#include "chartreuse/src/descriptors/barkbands.h"
+#include "chartreuse/src/descriptors/constantq.h"
+#include "chartreuse/src/descriptors/harmonicspectralcentroid.h"
+#include "chartreuse/src/descriptors/harmonicspectraldeviation.h"
+#include "chartreuse/src/descriptors/harmonicspectralspread.h"
+#include "chartreuse/src/descriptors/harmonicspectralvariation.h"
+#include "chartreuse/src/descriptors/logattacktime.h"
+#include "chartreuse/src/descriptors/melbands.h"
+#include "chartreuse/src/descriptors/mfcc.h"
+#include "chartreuse/src/descriptors/onsetstrength.h"
+#include "chartreuse/src/descriptors/pitchtrack.h"
+#include "chartreuse/src/descriptors/signalenvelope.h"
+#include "chartreuse/src/descriptors/temporalcentroid.h"
 
 #include "chartreuse/src/interface/interface_common.h"
 
 namespace chartreuse {
 namespace interface {
 
+// Internal forward declaration
+class AnalysisContext;
+
 /// @brief Manager class:
 /// Handle multiple descriptors retrieval in an efficient manner,
 /// by batching common processing between numerous descriptors.
+///
+/// The manager and all descriptors work on float samples only.
+/// Double precision is restricted to the manager-free building blocks:
+/// algorithms::BasicRingBuffer, algorithms::AutoCorrelation::Process
+/// and algorithms::BasicKissFFTPlan.
 class Manager {
  public:
   /// @brief Manager parameters class
@@ -64,7 +94,11 @@ class Manager {
                         const float low_freq = 62.5f,
                         const float high_freq = 1500.0f,
                         const unsigned int hop_size_sample = 480,
-                        const unsigned int overlap = 3);
+                        const unsigned int overlap = 3,
+                        const float octave_resolution = 0.25f,
+                        const PitchEstimator::Type pitch_estimator
+                          = PitchEstimator::kAutoCorrelation,
+                        const float silence_threshold = 0.0f);
 
     const float sampling_freq;  ///< Analysis sampling frequency
     const unsigned int dft_length;  ///< Spectrum signal length
@@ -77,6 +111,10 @@ class Manager {
     const unsigned int hop_size_sample;  ///< Input signal length
     const unsigned int overlap;  ///< Accumulated input signal overlap count
     const unsigned int window_length;  ///< Accumulated input signal length
+    const float octave_resolution;  ///< Logarithmic bands width, in octaves
+    const PitchEstimator::Type pitch_estimator;  ///< Fundamental freq. method
+    const float silence_threshold;  ///< AudioPower below which a frame is
+                                    ///< deemed silent (0 disables the gate)
 
    private:
     // No assignment operator for this class
@@ -85,12 +123,44 @@ class Manager {
 
   /// @brief Constructor, parameters have to be passed to it (no default)
   ///
+  /// A dedicated analysis context is built from these.
+  ///
   /// @param[in]  parameters    Analysis parameters to use
   /// @param[in]  zero_init   Zero initialization of internal memory,
   /// in order to compensate the missing beginning for all overlap algorithms
-  explicit Manager(const Parameters& parameters, const bool zero_init = true);
+  /// @param[in]  framing   Externally framed managers are only fed through
+  /// ProcessWindow(), hence do not hold any framing memory
+  explicit Manager(const Parameters& parameters,
+                   const bool zero_init = true,
+                   const Framing::Type framing = Framing::kInternal);
+
+  /// @brief Constructor sharing an existing analysis context
+  ///
+  /// All immutable tables are retrieved from the context, the manager only
+  /// holds its own mutable state (internal buffers, outputs).
+  ///
+  /// @param[in]  context    Analysis context to use
+  /// @param[in]  zero_init   Zero initialization of internal memory,
+  /// in order to compensate the missing beginning for all overlap algorithms
+  /// @param[in]  framing   See above
+  explicit Manager(const std::shared_ptr<const AnalysisContext>& context,
+                   const bool zero_init = true,
+                   const Framing::Type framing = Framing::kInternal);
+
   ~Manager();
 
+  /// @brief Retrieve an independent copy of this manager
+  ///
+  /// The analysis context is shared, hence no table is rebuilt:
+  /// only the current state is copied.
+  std::unique_ptr<Manager> Clone(void) const;
+
+  /// @brief Set the manager back to its just-constructed state
+  ///
+  /// All descriptors are disabled, internal buffers and stateful descriptors
+  /// are reset: this allows an instance to be reused for another signal.
+  void Reset(void);
+
   /// @brief Main processing function
   ///
   /// Feed the manager with the next signal frame.
@@ -106,6 +176,28 @@ class Manager {
   void ProcessFrame(const float* const frame,
                     const std::size_t frame_length);
 
+  /// @brief Processing function for already framed data
+  ///
+  /// Same as ProcessFrame, the internal ringbuffer being bypassed:
+  /// this allows framing to be done once for several managers.
+  /// Only for managers built with Framing::kExternal.
+  /// The window is not copied, it is directly apodized: it has to remain
+  /// valid until the next frame is processed.
+  ///
+  /// @param[in]  frame    Frame to be analysed
+  /// @param[in]  frame_length    Input frame length
+  /// @param[in]  window    Overlapped data window ending with this frame,
+  /// of window_length samples
+  void ProcessWindow(const float* const frame,
+                     const std::size_t frame_length,
+                     const float* const window);
+
+  /// @brief Start a new segment for segment-level descriptors
+  ///
+  /// Temporal descriptors (LogAttackTime, TemporalCentroid) are computed
+  /// over all frames since the manager creation or the last call to this.
+  void StartSegment(void);
+
   /// @brief Descriptor enabling
   ///
   /// Activate/deactivate the given descriptor,
@@ -127,6 +219,15 @@ class Manager {
   /// @return pointer to the first element of computed data
   const float* GetDescriptor(const DescriptorId::Type descriptor);
 
+  /// @brief Output buffer for a descriptor computed as a by-product
+  ///
+  /// Fused kernels compute several descriptors within the same pass:
+  /// the returned buffer has to be filled right away, since the descriptor
+  /// is then considered as computed for the current frame.
+  ///
+  /// @param[in]  descriptor    Descriptor to be provided, not computed yet
+  float* ProvideDescriptor(const DescriptorId::Type descriptor);
+
   /// @brief Retrieve the given descriptor metadata
   descriptors::Descriptor_Meta GetDescriptorMeta(
     const DescriptorId::Type descriptor) const;
@@ -134,6 +235,17 @@ class Manager {
   /// @brief Check if the given descriptor was computed for the current frame
   bool IsDescriptorComputed(const DescriptorId::Type descriptor) const;
 
+  /// @brief Check if the current frame is below the silence threshold
+  ///
+  /// Gated descriptors then skip their processing and output their
+  /// "silent" value instead. Always false if the gate is disabled.
+  bool IsSilent(void);
+
+  /// @brief Number of frames for which the given descriptor was gated
+  ///
+  /// Only counts the frames for which the descriptor was actually retrieved.
+  unsigned int GateHitCount(const DescriptorId::Type descriptor) const;
+
   /// @brief Descriptor output size
   ///
   /// Retrieve total size of all enabled descriptors
@@ -142,6 +254,12 @@ class Manager {
   /// @brief Analysis parameters getter
   const Parameters& AnalysisParameters(void) const;
 
+  /// @brief Analysis context getter
+  const AnalysisContext& Context(void) const;
+
+  /// @brief Shared analysis context getter, to be given to other managers
+  const std::shared_ptr<const AnalysisContext>& SharedContext(void) const;
+
   /// @brief Retrieve current data
   const float* CurrentFrame(void) const;
 
@@ -154,10 +272,42 @@ class Manager {
   /// @brief Retrieve current frequency scale
   const float* FrequencyScale(void) const;
 
+  /// @brief Retrieve past frames spectra, for stateful descriptors
+  ///
+  /// Once activated, the history is fed with each frame Dft before
+  /// moving on to the next one.
+  algorithms::SpectrumHistory& PastSpectra(void);
+
+  /// @brief Retrieve the scratch memory shared by all descriptors
+  ///
+  /// Descriptors temporary buffers are to be borrowed from it,
+  /// so that processing does not allocate.
+  algorithms::Workspace& Scratch(void);
+
  private:
   // No assignment operator for this class
   Manager& operator=(const Manager& right);
 
+  // No copy constructor for this class, see Clone()
+  // (nor move constructor: descriptors are bound to their manager)
+  Manager(const Manager& right);
+
+  /// @brief Retrieve the framing this instance was built with
+  Framing::Type FramingType(void) const;
+
+  /// @brief Copy the given manager state, built from the same context
+  void CopyState(const Manager& other);
+
+  /// @brief Fill the overlap buffer with the missing past signal (zeros)
+  void ZeroInit(void);
+
+  /// @brief Common frame processing beginning: invalidate previous frame data
+  /// and save the new frame
+  void BeginFrame(const float* const frame, const std::size_t frame_length);
+
+  /// @brief Common frame processing end, once the data window is updated
+  void EndFrame(void);
+
   /// @brief Set a descriptor as "computed" for the current frame
   void DescriptorIsComputed(const DescriptorId::Type descriptor,
                             const bool is_computed);
@@ -165,17 +315,29 @@ class Manager {
   /// @brief Retrieve the pointer for internal data buffer given the descriptor
   float* DescriptorDataPtr(const DescriptorId::Type descriptor);
 
+  /// @brief Retrieve the internal instance in charge of the given descriptor
+  descriptors::Descriptor_Interface* DescriptorInstance(
+    const DescriptorId::Type descriptor);
+  const descriptors::Descriptor_Interface* DescriptorInstance(
+    const DescriptorId::Type descriptor) const;
+
   std::array<bool, DescriptorId::kCount> enabled_descriptors_;
   std::array<bool, DescriptorId::kCount> computed_descriptors_;
+  std::array<unsigned int, DescriptorId::kCount> gate_hits_;
   std::vector<float> descriptors_data_;  ///< Temporary buffer
                                          ///< holding descriptors data result
   std::vector<float> current_frame_;  ///< Internal scratch memory
                                        ///< for input data saving
   std::vector<float> current_window_;  ///< Internal scratch memory
                                        ///< for overlapped data saving
+                                       ///< (empty if externally framed)
+  const float* window_;  ///< Current overlapped data window, either
+                         ///< internal or given to ProcessWindow()
   std::vector<float> current_window_apodized_;  ///< Internal scratch memory
                                                 ///< for overlapped data saving
-  const Parameters parameters_;
+  const std::shared_ptr<const AnalysisContext> context_;
+  const bool zero_init_;
+  algorithms::Workspace workspace_;  ///< Descriptors scratch memory
 
   // TODO(gm): use a smarter factory
   descriptors::AudioPower audio_power_;
@@ -184,14 +346,35 @@ class Manager {
   descriptors::AudioWaveform audio_waveform_;
   descriptors::AudioFundamentalFrequency audio_fundamental_frequency_;
   descriptors::AudioHarmonicity audio_harmonicity_;
-  algorithms::RingBuffer ringbuf_;
+  descriptors::AudioSpectrumSkewness audio_spectrum_skewness_;
+  descriptors::AudioSpectrumKurtosis audio_spectrum_kurtosis_;
+  descriptors::MelBands mel_bands_;
+  descriptors::BarkBands bark_bands_;
+  descriptors::MFCC mfcc_;
+  descriptors::AudioSpectrumEnvelope audio_spectrum_envelope_;
+  descriptors::AudioSpectrumFlatness audio_spectrum_flatness_;
+  descriptors::AudioUpperLimitOfHarmonicity audio_upper_limit_of_harmonicity_;
+  descriptors::HarmonicSpectralCentroid harmonic_spectral_centroid_;
+  descriptors::HarmonicSpectralDeviation harmonic_spectral_deviation_;
+  descriptors::HarmonicSpectralSpread harmonic_spectral_spread_;
+  descriptors::HarmonicSpectralVariation harmonic_spectral_variation_;
+  descriptors::ConstantQ constant_q_;
+  descriptors::OnsetStrength onset_strength_;
+  descriptors::SignalEnvelope signal_envelope_;
+  descriptors::LogAttackTime log_attack_time_;
+  descriptors::TemporalCentroid temporal_centroid_;
+  descriptors::PitchTrack pitch_track_;
+  std::unique_ptr<algorithms::RingBuffer> ringbuf_;  ///< Null if externally
+                                                    ///< framed
   algorithms::AutoCorrelation autocorrelation_;
   algorithms::KissFFT dft_;
   algorithms::Spectrogram spectrogram_;
   algorithms::DftPower dft_power_;
   algorithms::SpectrogramPower spectrogram_power_;
-  algorithms::Apodizer apodizer_;  ///< Dedicated object for window function application
-  algorithms::ScaleGenerator freq_scale_;  ///< Frequency scale generator
+  algorithms::SpectralMoments spectral_moments_;
+  algorithms::HarmonicPeaks harmonic_peaks_;
+  algorithms::NormalizedDifference normalized_difference_;
+  algorithms::SpectrumHistory spectrum_history_;
 };
 
 }  // namespace interface
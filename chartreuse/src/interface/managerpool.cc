@@ -0,0 +1,83 @@
+/// @file managerpool.cc
+/// @brief Manager instances pool definitions
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/interface/managerpool.h"
+
+// std::move
+#include <utility>
+
+#include "chartreuse/src/interface/analysiscontext.h"
+
+namespace chartreuse {
+namespace interface {
+
+ManagerPool::ManagerPool(const Manager::Parameters& parameters,
+                         const unsigned int preallocated,
+                         const bool zero_init)
+    : context_(std::make_shared<const AnalysisContext>(parameters)),
+      zero_init_(zero_init),
+      available_(),
+      mutex_() {
+  available_.reserve(preallocated);
+  for (unsigned int manager_idx(0);
+       manager_idx < preallocated;
+       ++manager_idx) {
+    available_.push_back(
+      std::unique_ptr<Manager>(new Manager(context_, zero_init_)));
+  }
+}
+
+ManagerPool::~ManagerPool() {
+  // Nothing to do here for now
+}
+
+std::unique_ptr<Manager> ManagerPool::Acquire(void) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!available_.empty()) {
+      std::unique_ptr<Manager> manager(std::move(available_.back()));
+      available_.pop_back();
+      return manager;
+    }
+  }
+  // Built outside of the lock, since this is the expensive part
+  return std::unique_ptr<Manager>(new Manager(context_, zero_init_));
+}
+
+void ManagerPool::Release(std::unique_ptr<Manager> manager) {
+  CHARTREUSE_ASSERT(manager != nullptr);
+  CHARTREUSE_ASSERT(manager->SharedContext() == context_);
+  manager->Reset();
+  std::lock_guard<std::mutex> lock(mutex_);
+  available_.push_back(std::move(manager));
+}
+
+std::size_t ManagerPool::AvailableCount(void) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return available_.size();
+}
+
+const std::shared_ptr<const AnalysisContext>&
+    ManagerPool::SharedContext(void) const {
+  return context_;
+}
+
+}  // namespace interface
+}  // namespace chartreuse
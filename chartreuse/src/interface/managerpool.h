@@ -0,0 +1,95 @@
+/// @file managerpool.h
+/// @brief Manager instances pool declarations
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_INTERFACE_MANAGERPOOL_H_
+#define CHARTREUSE_SRC_INTERFACE_MANAGERPOOL_H_
+
+// std::shared_ptr, std::unique_ptr
+#include <memory>
+// std::mutex
+#include <mutex>
+// std::vector
+#include <vector>
+
+#include "chartreuse/src/common.h"
+
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace interface {
+
+// Internal forward declaration
+class AnalysisContext;
+
+/// @brief Manager instances pool: recycle managers sharing the same
+/// analysis parameters
+///
+/// Building a manager requires all its internal buffers to be allocated,
+/// which may show up when analysing numerous short signals: released
+/// managers are reset and handed out again instead.
+/// All managers share a single analysis context, hence tables are only
+/// built once for the whole pool.
+///
+/// Acquiring and releasing managers is thread-safe,
+/// using the managers themselves is not.
+class ManagerPool {
+ public:
+  /// @brief Constructor
+  ///
+  /// @param[in]  parameters    Analysis parameters for all managers
+  /// @param[in]  preallocated    Managers count to be built right away
+  /// @param[in]  zero_init    Zero initialization of managers internal memory
+  explicit ManagerPool(const Manager::Parameters& parameters,
+                       const unsigned int preallocated = 0,
+                       const bool zero_init = true);
+  ~ManagerPool();
+
+  /// @brief Retrieve a manager, in its just-constructed state
+  ///
+  /// A new one is built if the pool is empty.
+  std::unique_ptr<Manager> Acquire(void);
+
+  /// @brief Give back a manager previously acquired from this pool
+  ///
+  /// It is reset right away, so that it is ready for the next acquisition.
+  void Release(std::unique_ptr<Manager> manager);
+
+  /// @brief Count of managers ready to be acquired without any construction
+  std::size_t AvailableCount(void) const;
+
+  /// @brief Shared analysis context getter
+  const std::shared_ptr<const AnalysisContext>& SharedContext(void) const;
+
+ private:
+  // No assignment operator for this class
+  ManagerPool& operator=(const ManagerPool& right);
+  // No copy constructor for this class
+  ManagerPool(const ManagerPool& right);
+
+  const std::shared_ptr<const AnalysisContext> context_;
+  const bool zero_init_;
+  std::vector<std::unique_ptr<Manager> > available_;  ///< Reset managers
+  mutable std::mutex mutex_;  ///< Protects available_
+};
+
+}  // namespace interface
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_INTERFACE_MANAGERPOOL_H_
@@ -0,0 +1,130 @@
+/// @file multiresolutionmanager.cc
+/// @brief MultiResolutionManager class implementation
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/src/interface/multiresolutionmanager.h"
+
+// std::max
+#include <algorithm>
+
+namespace chartreuse {
+namespace interface {
+
+/// @brief Helper retrieving the longest overlap of all resolutions
+static unsigned int MaxOverlap(
+    const std::vector<Manager::Parameters>& resolutions) {
+  CHARTREUSE_ASSERT(!resolutions.empty());
+  unsigned int max_overlap(0);
+  for (const Manager::Parameters& parameters : resolutions) {
+    max_overlap = std::max(max_overlap, parameters.overlap);
+  }
+  return max_overlap;
+}
+
+/// @brief Helper checking whether the descriptor does not depend
+/// on the analysis window
+static bool IsTimeDomain(const DescriptorId::Type descriptor) {
+  return (descriptor == DescriptorId::kAudioPower)
+         || (descriptor == DescriptorId::kAudioWaveform)
+         || (descriptor == DescriptorId::kSignalEnvelope)
+         || (descriptor == DescriptorId::kLogAttackTime)
+         || (descriptor == DescriptorId::kTemporalCentroid);
+}
+
+MultiResolutionManager::MultiResolutionManager(
+    const std::vector<Manager::Parameters>& resolutions)
+    : managers_(),
+      max_overlap_(MaxOverlap(resolutions)),
+      ringbuf_(resolutions[0].hop_size_sample * max_overlap_),
+      current_window_(resolutions[0].hop_size_sample * max_overlap_) {
+  for (const Manager::Parameters& parameters : resolutions) {
+    CHARTREUSE_ASSERT(parameters.sampling_freq
+                      == resolutions[0].sampling_freq);
+    CHARTREUSE_ASSERT(parameters.hop_size_sample
+                      == resolutions[0].hop_size_sample);
+    // Framing is done here: no ringbuffer within each manager
+    managers_.emplace_back(new Manager(parameters, false, Framing::kExternal));
+  }
+  // Same as Manager zero initialization: the first input buffer is to be
+  // considered as the "future" part in the overlap
+  ringbuf_.Fill(0.0f, ringbuf_.Capacity() - resolutions[0].hop_size_sample);
+}
+
+MultiResolutionManager::~MultiResolutionManager() {
+  // Nothing to do here for now
+}
+
+void MultiResolutionManager::ProcessFrame(const float* const frame,
+                                          const std::size_t frame_length) {
+  CHARTREUSE_ASSERT(frame != nullptr);
+  CHARTREUSE_ASSERT(frame_length > 0);
+
+  ringbuf_.Push(frame, frame_length);
+  ringbuf_.PopOverlapped(&current_window_[0],
+                         current_window_.size(),
+                         max_overlap_);
+  // Each resolution window is the latest part of the longest one
+  for (const std::unique_ptr<Manager>& manager : managers_) {
+    const unsigned int kWindowLength(
+      manager->AnalysisParameters().window_length);
+    manager->ProcessWindow(frame,
+                           frame_length,
+                           &current_window_[current_window_.size()
+                                            - kWindowLength]);
+  }
+}
+
+const float* MultiResolutionManager::GetDescriptor(
+    const unsigned int resolution,
+    const DescriptorId::Type descriptor) {
+  return managers_[ActualResolution(resolution, descriptor)]
+    ->GetDescriptor(descriptor);
+}
+
+descriptors::Descriptor_Meta MultiResolutionManager::GetDescriptorMeta(
+    const unsigned int resolution,
+    const DescriptorId::Type descriptor) const {
+  return managers_[ActualResolution(resolution, descriptor)]
+    ->GetDescriptorMeta(descriptor);
+}
+
+void MultiResolutionManager::StartSegment(void) {
+  // Segment-level descriptors are only computed by the first resolution
+  managers_[0]->StartSegment();
+}
+
+unsigned int MultiResolutionManager::ResolutionsCount(void) const {
+  return static_cast<unsigned int>(managers_.size());
+}
+
+Manager& MultiResolutionManager::Resolution(const unsigned int resolution) {
+  CHARTREUSE_ASSERT(resolution < ResolutionsCount());
+  return *managers_[resolution];
+}
+
+unsigned int MultiResolutionManager::ActualResolution(
+    const unsigned int resolution,
+    const DescriptorId::Type descriptor) const {
+  CHARTREUSE_ASSERT(resolution < ResolutionsCount());
+  CHARTREUSE_ASSERT(descriptor != DescriptorId::kCount);
+  return IsTimeDomain(descriptor) ? 0 : resolution;
+}
+
+}  // namespace interface
+}  // namespace chartreuse
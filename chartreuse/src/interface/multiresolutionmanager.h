@@ -0,0 +1,110 @@
+/// @file multiresolutionmanager.h
+/// @brief MultiResolutionManager class declaration
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CHARTREUSE_SRC_INTERFACE_MULTIRESOLUTIONMANAGER_H_
+#define CHARTREUSE_SRC_INTERFACE_MULTIRESOLUTIONMANAGER_H_
+
+#include <memory>
+#include <vector>
+
+#include "chartreuse/src/common.h"
+
+#include "chartreuse/src/algorithms/ringbuffer.h"
+#include "chartreuse/src/interface/interface_common.h"
+#include "chartreuse/src/interface/manager.h"
+
+namespace chartreuse {
+namespace interface {
+
+/// @brief Multi-resolution manager class:
+/// Handle descriptors retrieval for several analysis resolutions at once
+/// (e.g. a short window for transients and a long one for pitch)
+///
+/// One manager is in charge of each resolution, with its own window and
+/// transform; framing is done only once, from a single ringbuffer.
+/// Each manager directly apodizes its part of the shared window, without
+/// any intermediate copy.
+/// Time-domain descriptors, which do not depend on the resolution, are only
+/// computed by the first one.
+///
+/// All resolutions must share their sampling frequency and hop size.
+class MultiResolutionManager {
+ public:
+  /// @brief Constructor, one set of parameters per resolution
+  ///
+  /// Internal memory is zero-initialized, as done by Manager.
+  ///
+  /// @param[in]  resolutions    Analysis parameters for each resolution
+  explicit MultiResolutionManager(
+    const std::vector<Manager::Parameters>& resolutions);
+  ~MultiResolutionManager();
+
+  /// @brief Main processing function
+  ///
+  /// Feed all resolutions with the next signal frame
+  ///
+  /// @param[in]  frame    Frame to be analysed
+  /// @param[in]  frame_length    Input frame length
+  void ProcessFrame(const float* const frame,
+                    const std::size_t frame_length);
+
+  /// @brief Per-descriptor processing function, for the given resolution
+  ///
+  /// @param[in]  resolution    Resolution index
+  /// @param[in]  descriptor    Descriptor to be retrieved
+  ///
+  /// @return pointer to the first element of computed data
+  const float* GetDescriptor(const unsigned int resolution,
+                             const DescriptorId::Type descriptor);
+
+  /// @brief Retrieve the given descriptor metadata, for the given resolution
+  descriptors::Descriptor_Meta GetDescriptorMeta(
+    const unsigned int resolution,
+    const DescriptorId::Type descriptor) const;
+
+  /// @brief Start a new segment for segment-level descriptors
+  void StartSegment(void);
+
+  /// @brief Resolutions count
+  unsigned int ResolutionsCount(void) const;
+
+  /// @brief Retrieve the manager in charge of the given resolution
+  Manager& Resolution(const unsigned int resolution);
+
+ private:
+  // No assignment operator for this class
+  MultiResolutionManager& operator=(const MultiResolutionManager& right);
+  // No copy constructor for this class
+  MultiResolutionManager(const MultiResolutionManager& right);
+
+  /// @brief Retrieve the resolution actually in charge of the descriptor
+  unsigned int ActualResolution(const unsigned int resolution,
+                                const DescriptorId::Type descriptor) const;
+
+  std::vector<std::unique_ptr<Manager> > managers_;  ///< One per resolution
+  const unsigned int max_overlap_;  ///< Longest window overlap
+  algorithms::RingBuffer ringbuf_;  ///< Shared framing, longest window
+  std::vector<float> current_window_;  ///< Longest overlapped data window
+};
+
+}  // namespace interface
+}  // namespace chartreuse
+
+#endif  // CHARTREUSE_SRC_INTERFACE_MULTIRESOLUTIONMANAGER_H_
@@ -0,0 +1,99 @@
+/// @file tests_algorithms_common.cc
+/// @brief Chartreuse common algorithms tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/algorithms_common.h"
+
+// Using declarations for tested functions
+using chartreuse::algorithms::ParabolicApproximation;
+using chartreuse::algorithms::ParabolicArgMin;
+using chartreuse::algorithms::LinearInterpolation;
+
+/// @brief Straightforward, one element at a time peak search
+static float ParabolicApproximationReference(const float* const data,
+                                             const unsigned int data_length,
+                                             const float threshold,
+                                             float* const argmin) {
+  float min_value(0.0f);
+  float arg_min(0);
+  for (unsigned int idx(1); idx < data_length - 1; ++idx) {
+    const float prev(data[idx - 1]);
+    const float peak(data[idx]);
+    const float next(data[idx + 1]);
+    if ((peak - prev > 0.0f) && (next - peak < 0.0f)) {
+      const float tmp_argmin(ParabolicArgMin(prev, peak, next) + 1.0f);
+      const float tmp_min(LinearInterpolation(prev, peak, tmp_argmin));
+      if (tmp_min > min_value + threshold) {
+        arg_min = tmp_argmin + idx;
+        min_value = tmp_min;
+      }
+    }
+  }
+  *argmin = arg_min;
+  return min_value;
+}
+
+/// @brief Check the block peak search against the reference one
+/// on white noise, for lengths around the block length
+TEST(AlgorithmsCommon, ParabolicApproximationWhiteNoise) {
+  const float kThreshold(5e-3f);
+  std::vector<float> data(1000);
+  for (unsigned int length(1); length < data.size(); length += 7) {
+    std::generate(data.begin(),
+                  data.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    float argmin(-1.0f);
+    float expected_argmin(-1.0f);
+    const float kValue(ParabolicApproximation(&data[0],
+                                              length,
+                                              kThreshold,
+                                              &argmin));
+    const float kExpectedValue(ParabolicApproximationReference(
+      &data[0],
+      length,
+      kThreshold,
+      &expected_argmin));
+    EXPECT_EQ(kExpectedValue, kValue);
+    EXPECT_EQ(expected_argmin, argmin);
+  }
+}
+
+/// @brief Plateaus and monotonic parts are not peaks
+TEST(AlgorithmsCommon, ParabolicApproximationPlateau) {
+  const std::vector<float> kData = {0.0f, 1.0f, 1.0f, 0.5f,
+                                    0.2f, 0.6f, 0.3f, 0.4f};
+  float argmin(0.0f);
+  const float kValue(ParabolicApproximation(&kData[0],
+                                            kData.size(),
+                                            0.0f,
+                                            &argmin));
+  float expected_argmin(0.0f);
+  const float kExpectedValue(ParabolicApproximationReference(
+    &kData[0],
+    kData.size(),
+    0.0f,
+    &expected_argmin));
+  EXPECT_EQ(kExpectedValue, kValue);
+  EXPECT_EQ(expected_argmin, argmin);
+  // Only the peak at index 5 is considered
+  EXPECT_LT(5.0f, argmin);
+  EXPECT_GT(7.0f, argmin);
+}
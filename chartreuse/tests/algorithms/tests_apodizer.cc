@@ -165,3 +165,25 @@ TEST(Apodizer, HammingApplyPerf) {
     index += frame.size();
   }
 }
+
+/// @brief Out-of-place windowing of a shorter input has to be the same as
+/// windowing a zero-padded copy of it in-place
+TEST(Apodizer, OutOfPlace) {
+  const unsigned int kWindowLength(2048);
+  const unsigned int kInputLength(1440);
+  Apodizer apodizer(kWindowLength, kHamming);
+  std::vector<float> input(kInputLength);
+  std::generate(input.begin(),
+                input.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+  std::vector<float> expected(kWindowLength, 0.0f);
+  std::copy(input.begin(), input.end(), expected.begin());
+  apodizer.ApplyWindow(&expected[0]);
+  // Garbage in the output padding
+  std::vector<float> output(kWindowLength, 1.0f);
+
+  apodizer.ApplyWindow(&input[0], kInputLength, &output[0]);
+  for (unsigned int i(0); i < kWindowLength; ++i) {
+    EXPECT_EQ(expected[i], output[i]);
+  }
+}
@@ -20,9 +20,13 @@
 
 #include "chartreuse/tests/tests.h"
 
+#include "chartreuse/src/algorithms/autocorrelation.h"
+#include "chartreuse/src/algorithms/ringbuffer.h"
 #include "chartreuse/src/interface/manager.h"
 
 // Useful using declarations
+using chartreuse::algorithms::AutoCorrelation;
+using chartreuse::algorithms::BasicRingBuffer;
 using chartreuse::interface::Manager;
 using chartreuse::interface::DescriptorId::kAutoCorrelation;
 
@@ -81,3 +85,85 @@ TEST(AutoCorrelation, Perf) {
     index += frame.size();
   }
 }
+
+/// @brief Frame a long, offset sine in double precision then compute its
+/// autocorrelation in both precisions: check both against a long double
+/// reference, the double one having to be (almost) exact
+TEST(AutoCorrelation, DoublePrecision) {
+  const unsigned int kHopSize(4096);
+  const unsigned int kOverlap(4);
+  const unsigned int kWindowLength(kHopSize * kOverlap);
+  const unsigned int kMinLag(20);
+  const unsigned int kMaxLag(1000);
+  const double kPeriod(123.4);
+
+  BasicRingBuffer<double> ringbuf(kWindowLength);
+  std::vector<double> hop(kHopSize);
+  std::vector<double> window(kWindowLength);
+  for (unsigned int hop_idx(0); hop_idx < kOverlap; ++hop_idx) {
+    for (unsigned int i(0); i < kHopSize; ++i) {
+      const double kTime(static_cast<double>(hop_idx * kHopSize + i));
+      hop[i] = 100.0 + std::sin(2.0 * M_PI * kTime / kPeriod);
+    }
+    ringbuf.Push(&hop[0], kHopSize);
+  }
+  ringbuf.PopOverlapped(&window[0], kWindowLength, kOverlap);
+
+  std::vector<double> output(kMaxLag - kMinLag);
+  // No manager is required for the independent process method
+  AutoCorrelation::Process(&window[0], kWindowLength, kMinLag, kMaxLag,
+                           &output[0]);
+  const std::vector<float> kWindowFloat(window.begin(), window.end());
+  std::vector<float> output_float(kMaxLag - kMinLag);
+  AutoCorrelation::Process(&kWindowFloat[0], kWindowLength, kMinLag, kMaxLag,
+                           &output_float[0]);
+
+  const unsigned int kLength(kWindowLength - kMaxLag);
+  long double power(0.0);
+  for (unsigned int i(kMaxLag); i < kWindowLength; ++i) {
+    power += static_cast<long double>(window[i]) * window[i];
+  }
+  for (unsigned int lag(kMinLag); lag < kMaxLag; ++lag) {
+    long double corr_power(0.0);
+    long double lag_power(0.0);
+    for (unsigned int i(0); i < kLength; ++i) {
+      const long double kLagged(window[kMaxLag - lag + i]);
+      corr_power += kLagged * window[kMaxLag + i];
+      lag_power += kLagged * kLagged;
+    }
+    const double kExpected(static_cast<double>(
+      corr_power / std::sqrt(power * 2.0 * lag_power)));
+    EXPECT_NEAR(kExpected, output[lag - kMinLag], 1e-12);
+    EXPECT_NEAR(kExpected, output_float[lag - kMinLag], 1e-3);
+  }
+}
+
+/// @brief Compute overlapping frames autocorrelations in a single batch,
+/// compare with the frame by frame computation
+TEST(AutoCorrelation, Batch) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  AutoCorrelation autocorrelation(&manager);
+  const Manager::Parameters& kParameters(manager.AnalysisParameters());
+  const std::size_t kFrameLength(kParameters.window_length);
+  const std::size_t kStride(kParameters.hop_size_sample);
+  const std::size_t kFramesCount(4);
+  const unsigned int kOutputLength(kParameters.max_lag - kParameters.min_lag);
+  std::vector<float> data(kFrameLength + (kFramesCount - 1) * kStride);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+
+  std::vector<float> out_data(kFramesCount * kOutputLength);
+  autocorrelation.Process(&data[0], kFrameLength, kFramesCount, kStride,
+                          kParameters.min_lag, kParameters.max_lag,
+                          &out_data[0]);
+  std::vector<float> expected(kOutputLength);
+  for (std::size_t frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+    autocorrelation.Process(&data[frame_idx * kStride], kFrameLength,
+                            kParameters.min_lag, kParameters.max_lag,
+                            &expected[0]);
+    for (unsigned int i(0); i < kOutputLength; ++i) {
+      EXPECT_EQ(expected[i], out_data[frame_idx * kOutputLength + i]);
+    }
+  }
+}
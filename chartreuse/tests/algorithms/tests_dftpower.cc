@@ -0,0 +1,53 @@
+/// @file tests_dftpower.cc
+/// @brief Chartreuse Dft power algorithm tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/dftpower.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Useful using declarations
+using chartreuse::algorithms::DftPower;
+using chartreuse::interface::Manager;
+
+/// @brief Compute many Dfts power in a single batch,
+/// compare with the Dft by Dft computation
+TEST(DftPower, Batch) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  DftPower dft_power(&manager);
+  const std::size_t kDftLength(manager.AnalysisParameters().dft_length + 2);
+  const std::size_t kStride(kDftLength + 4);
+  const std::size_t kFramesCount(5);
+  std::vector<float> data(kFramesCount * kStride);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+
+  std::vector<float> out_data(kFramesCount * kDftLength / 2);
+  dft_power.Process(&data[0], kDftLength, kFramesCount, kStride,
+                    &out_data[0]);
+  std::vector<float> expected(kDftLength / 2);
+  for (std::size_t frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+    dft_power.Process(&data[frame_idx * kStride], kDftLength, &expected[0]);
+    for (std::size_t i(0); i < expected.size(); ++i) {
+      EXPECT_FLOAT_EQ(expected[i], out_data[frame_idx * expected.size() + i]);
+    }
+  }
+}
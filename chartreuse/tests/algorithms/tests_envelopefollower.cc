@@ -0,0 +1,76 @@
+/// @file tests_envelopefollower.cc
+/// @brief Chartreuse envelope follower tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/envelopefollower.h"
+
+// Using declarations for tested classes
+using chartreuse::algorithms::AttackTracker;
+using chartreuse::algorithms::EnvelopeFollower;
+
+/// @brief Check the follower step response against its time constants
+TEST(EnvelopeFollower, Step) {
+  const float kFrameDuration(0.01f);
+  const float kAttackTime(0.05f);
+  const float kReleaseTime(0.2f);
+  EnvelopeFollower follower(kAttackTime, kReleaseTime, kFrameDuration);
+
+  // After one time constant, 1 - 1/e of the step is reached
+  float envelope(0.0f);
+  for (unsigned int frame_idx(0); frame_idx < 5; ++frame_idx) {
+    envelope = follower.Process(1.0f);
+  }
+  EXPECT_NEAR(1.0f - std::exp(-1.0f), envelope, 1e-5f);
+  for (unsigned int frame_idx(0); frame_idx < 20; ++frame_idx) {
+    envelope = follower.Process(0.0f);
+  }
+  EXPECT_NEAR((1.0f - std::exp(-1.0f)) * std::exp(-1.0f), envelope, 1e-5f);
+}
+
+/// @brief Check crossing times on a linear ramp, then on a higher one after
+/// which the maximum is updated
+TEST(EnvelopeFollower, AttackTrackerRamp) {
+  const float kFrameDuration(0.01f);
+  // Ladder resolution: 1dB
+  const float kTolerance(std::pow(10.0f, 1.0f / 20.0f) - 1.0f);
+  AttackTracker tracker(1e-5f, 1.0f, 20, kFrameDuration);
+
+  // Reaching 0.5 in 50 frames
+  for (unsigned int frame_idx(0); frame_idx <= 50; ++frame_idx) {
+    tracker.Push(frame_idx * 0.01f);
+  }
+  EXPECT_NEAR(0.5f, tracker.MaximumTime(), 1e-5f);
+  EXPECT_NEAR(0.25f, tracker.CrossingTime(0.5f), 0.25f * kTolerance);
+  EXPECT_NEAR(0.45f, tracker.CrossingTime(0.9f), 0.45f * kTolerance);
+  // Decay, then reaching 1.0 later on
+  for (unsigned int frame_idx(0); frame_idx < 50; ++frame_idx) {
+    tracker.Push(0.1f);
+  }
+  tracker.Push(1.0f);
+  EXPECT_NEAR(1.01f, tracker.MaximumTime(), 1e-5f);
+  // Crossed during the first ramp
+  EXPECT_NEAR(0.45f, tracker.CrossingTime(0.45f), 0.45f * kTolerance);
+  // Crossed at the end
+  EXPECT_NEAR(1.01f, tracker.CrossingTime(0.9f), kFrameDuration);
+  tracker.Reset();
+  tracker.Push(0.0f);
+  EXPECT_EQ(0.0f, tracker.MaximumTime());
+}
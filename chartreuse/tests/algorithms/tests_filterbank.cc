@@ -0,0 +1,123 @@
+/// @file tests_filterbank.cc
+/// @brief Chartreuse filter bank and Dct tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/dct.h"
+#include "chartreuse/src/algorithms/filterbank.h"
+
+// Using declarations for tested classes
+using chartreuse::algorithms::Dct;
+using chartreuse::algorithms::FilterBank;
+// Useful using declarations
+using chartreuse::algorithms::Bands::kBark;
+using chartreuse::algorithms::Bands::kMel;
+
+/// @brief Filters are normalized: a flat spectrum gives unity bands output
+TEST(FilterBank, FlatSpectrum) {
+  const unsigned int kDftLength(2048);
+  const unsigned int kBandsCount(40);
+  std::vector<float> spectrum(kDftLength / 2 + 1, 1.0f);
+  std::vector<float> bands(kBandsCount);
+  for (const auto type : {kMel, kBark}) {
+    const FilterBank filter_bank(type,
+                                 kBandsCount,
+                                 kDftLength,
+                                 kSamplingFreq,
+                                 0.0f,
+                                 kSamplingFreq / 2.0f);
+    EXPECT_EQ(kBandsCount, filter_bank.BandsCount());
+    filter_bank.Apply(&spectrum[0], &bands[0]);
+    for (unsigned int band(0); band < kBandsCount; ++band) {
+      EXPECT_NEAR(1.0f, bands[band], 1e-5f);
+    }
+  }
+}
+
+/// @brief A single spectrum bin contributes to at most two adjacent bands,
+/// which have to be ordered along with the bin frequency
+TEST(FilterBank, SingleBin) {
+  const unsigned int kDftLength(2048);
+  const unsigned int kBandsCount(40);
+  const unsigned int kSpectrumLength(kDftLength / 2 + 1);
+  const FilterBank filter_bank(kMel,
+                               kBandsCount,
+                               kDftLength,
+                               kSamplingFreq,
+                               0.0f,
+                               kSamplingFreq / 2.0f);
+  std::vector<float> spectrum(kSpectrumLength, 0.0f);
+  std::vector<float> bands(kBandsCount);
+  unsigned int previous_band(0);
+  for (unsigned int bin(1); bin < kSpectrumLength - 1; bin += 7) {
+    std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+    spectrum[bin] = 1.0f;
+    filter_bank.Apply(&spectrum[0], &bands[0]);
+    unsigned int first_band(kBandsCount);
+    unsigned int nonzero_count(0);
+    for (unsigned int band(0); band < kBandsCount; ++band) {
+      if (bands[band] > 0.0f) {
+        first_band = std::min(first_band, band);
+        nonzero_count += 1;
+      }
+    }
+    EXPECT_GE(2u, nonzero_count);
+    if (nonzero_count > 0) {
+      EXPECT_LE(previous_band, first_band);
+      previous_band = first_band;
+    }
+  }
+}
+
+/// @brief A constant input only has a DC coefficient
+TEST(Dct, Constant) {
+  const unsigned int kInputLength(40);
+  const unsigned int kOutputLength(13);
+  const float kConstant(2.0f);
+  const Dct dct(kInputLength, kOutputLength);
+  std::vector<float> input(kInputLength, kConstant);
+  std::vector<float> output(kOutputLength);
+  dct.Apply(&input[0], &output[0]);
+  EXPECT_NEAR(kConstant * std::sqrt(static_cast<float>(kInputLength)),
+              output[0],
+              1e-4f);
+  for (unsigned int i(1); i < kOutputLength; ++i) {
+    EXPECT_NEAR(0.0f, output[i], 1e-4f);
+  }
+}
+
+/// @brief The full transform is orthonormal, hence preserves the energy
+TEST(Dct, Energy) {
+  const unsigned int kLength(24);
+  const Dct dct(kLength, kLength);
+  std::vector<float> input(kLength);
+  std::vector<float> output(kLength);
+  std::generate(input.begin(),
+                input.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+  dct.Apply(&input[0], &output[0]);
+  float input_energy(0.0f);
+  float output_energy(0.0f);
+  for (unsigned int i(0); i < kLength; ++i) {
+    input_energy += input[i] * input[i];
+    output_energy += output[i] * output[i];
+  }
+  EXPECT_NEAR(input_energy, output_energy, 1e-4f * kLength);
+}
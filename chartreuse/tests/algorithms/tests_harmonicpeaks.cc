@@ -0,0 +1,100 @@
+/// @file tests_harmonicpeaks.cc
+/// @brief Chartreuse harmonic peaks extraction tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/harmonicpeaks.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Using declarations for tested class
+using chartreuse::algorithms::HarmonicPeaks;
+// Useful using declarations
+using chartreuse::algorithms::HarmonicPeakData;
+using chartreuse::algorithms::HarmonicsCount;
+using chartreuse::algorithms::kMaxHarmonicsCount;
+using chartreuse::interface::Manager;
+namespace HarmonicPeak = chartreuse::algorithms::HarmonicPeak;
+
+/// @brief Synthetic spectrum with peaks exactly on some harmonics bins:
+/// check that all of them are found, and only them
+TEST(HarmonicPeaks, SyntheticSpectrum) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  HarmonicPeaks harmonic_peaks(&manager);
+  const unsigned int kDftLength(manager.AnalysisParameters().dft_length);
+  const unsigned int kSpectrumLength(kDftLength / 2 + 1);
+  const float kBinWidth(kSamplingFreq / kDftLength);
+  // Fundamental exactly on the 10th bin
+  const unsigned int kFundamentalBin(10);
+  const float kLag(kSamplingFreq / (kFundamentalBin * kBinWidth));
+
+  std::vector<float> spectrum(kSpectrumLength, 1e-3f);
+  for (unsigned int bin(kFundamentalBin);
+       bin < kSpectrumLength - 1;
+       bin += kFundamentalBin) {
+    // Every third harmonic is missing
+    if ((bin / kFundamentalBin) % 3 != 0) {
+      spectrum[bin] = 1.0f;
+    }
+  }
+  std::vector<float> output(harmonic_peaks.Meta().out_dim);
+  harmonic_peaks.Process(&spectrum[0],
+                         kSpectrumLength,
+                         kLag,
+                         kSamplingFreq,
+                         &output[0]);
+
+  const unsigned int kHarmonicsCount(HarmonicsCount(&output[0]));
+  EXPECT_EQ(std::min(kMaxHarmonicsCount,
+                     (kSpectrumLength - 2) / kFundamentalBin),
+            kHarmonicsCount);
+  for (unsigned int harmonic(0); harmonic < kHarmonicsCount; ++harmonic) {
+    const float* const kPeak(HarmonicPeakData(&output[0], harmonic));
+    EXPECT_NEAR((harmonic + 1) * kFundamentalBin * kBinWidth,
+                kPeak[HarmonicPeak::kFrequency],
+                1e-2f);
+    const float kExpected(((harmonic + 1) % 3 != 0) ? 1.0f : 0.0f);
+    EXPECT_NEAR(kExpected, kPeak[HarmonicPeak::kAmplitude], 1e-3f);
+  }
+}
+
+/// @brief Check that a peak between two bins is refined
+TEST(HarmonicPeaks, Refinement) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  HarmonicPeaks harmonic_peaks(&manager);
+  const unsigned int kDftLength(manager.AnalysisParameters().dft_length);
+  const unsigned int kSpectrumLength(kDftLength / 2 + 1);
+  const float kBinWidth(kSamplingFreq / kDftLength);
+  const float kLag(kSamplingFreq / (20.0f * kBinWidth));
+
+  std::vector<float> spectrum(kSpectrumLength, 0.0f);
+  // Symmetric parabola centered on 20.25
+  spectrum[19] = 1.0f - 1.25f * 1.25f;
+  spectrum[20] = 1.0f - 0.25f * 0.25f;
+  spectrum[21] = 1.0f - 0.75f * 0.75f;
+  std::vector<float> output(harmonic_peaks.Meta().out_dim);
+  harmonic_peaks.Process(&spectrum[0],
+                         kSpectrumLength,
+                         kLag,
+                         kSamplingFreq,
+                         &output[0]);
+  const float* const kPeak(HarmonicPeakData(&output[0], 0));
+  EXPECT_NEAR(20.25f * kBinWidth, kPeak[HarmonicPeak::kFrequency], 1e-3f);
+  EXPECT_NEAR(1.0f, kPeak[HarmonicPeak::kAmplitude], 1e-4f);
+}
@@ -24,7 +24,9 @@
 #include "chartreuse/src/algorithms/kissfft.h"
 
 // Useful using declarations
+using chartreuse::algorithms::BasicKissFFTPlan;
 using chartreuse::algorithms::KissFFT;
+using chartreuse::algorithms::KissFFTPlan;
 using chartreuse::interface::Manager;
 using chartreuse::interface::DescriptorId::kDft;
 
@@ -250,3 +252,61 @@ TEST(KissFFT, SinLargeLength) {
     EXPECT_NEAR(kDataLargeSinDFT[i / 2], out_data[i], kEpsilon);
   }
 }
+
+/// @brief Check that the inverse transform of a white noise DFT
+/// gives back the (scaled) input
+TEST(KissFFT, InverseRoundTrip) {
+  const unsigned int kDftLength(kLargeDFTLength);
+  std::vector<float> data(kDftLength);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+  std::vector<float> dft(kDftLength + 2);
+  std::vector<float> out_data(kDftLength);
+
+  const KissFFTPlan plan(kDftLength);
+  std::vector<kiss_fft_cpx> scratch(plan.ScratchLength());
+  plan.Process(&data[0], &scratch[0], &dft[0]);
+  plan.ProcessInverse(&dft[0], &scratch[0], &out_data[0]);
+
+  const float kEpsilon(1e-5f);
+  for (unsigned int i(0); i < kDftLength; ++i) {
+    EXPECT_NEAR(data[i], out_data[i] / kDftLength, kEpsilon);
+  }
+}
+
+/// @brief Check the double precision transform of a white noise
+/// against a long double naive DFT, then its inverse round trip
+TEST(KissFFT, DoublePrecision) {
+  const unsigned int kDftLength(kFFTDataSize);
+  std::vector<double> data(kDftLength);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+  std::vector<double> dft(kDftLength + 2);
+  std::vector<double> out_data(kDftLength);
+
+  const BasicKissFFTPlan<double> plan(kDftLength);
+  std::vector<BasicKissFFTPlan<double>::Complex> scratch(plan.ScratchLength());
+  plan.Process(&data[0], &scratch[0], &dft[0]);
+
+  const long double kPi(3.141592653589793238462643383279502884L);
+  const double kEpsilon(1e-11);
+  for (unsigned int k(0); k <= kDftLength / 2; ++k) {
+    long double real(0.0L);
+    long double imag(0.0L);
+    for (unsigned int i(0); i < kDftLength; ++i) {
+      const long double kPhase(-2.0L * kPi * ((k * i) % kDftLength)
+                               / kDftLength);
+      real += data[i] * std::cos(kPhase);
+      imag += data[i] * std::sin(kPhase);
+    }
+    EXPECT_NEAR(static_cast<double>(real), dft[2 * k], kEpsilon);
+    EXPECT_NEAR(static_cast<double>(imag), dft[2 * k + 1], kEpsilon);
+  }
+
+  plan.ProcessInverse(&dft[0], &scratch[0], &out_data[0]);
+  for (unsigned int i(0); i < kDftLength; ++i) {
+    EXPECT_NEAR(data[i], out_data[i] / kDftLength, kEpsilon);
+  }
+}
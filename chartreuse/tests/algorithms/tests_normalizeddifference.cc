@@ -0,0 +1,85 @@
+/// @file tests_normalizeddifference.cc
+/// @brief Chartreuse cumulative mean normalized difference tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/normalizeddifference.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Useful using declarations
+using chartreuse::algorithms::NormalizedDifference;
+using chartreuse::interface::Manager;
+
+/// @brief Compare the FFT-based computation of a white noise CMNDF
+/// with its direct definition
+TEST(NormalizedDifference, WhiteNoise) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  NormalizedDifference normalized_difference(&manager);
+  const unsigned int kWindowLength(
+    manager.AnalysisParameters().window_length);
+  const unsigned int kMinLag(manager.AnalysisParameters().min_lag);
+  const unsigned int kMaxLag(manager.AnalysisParameters().max_lag);
+
+  std::vector<float> data(kWindowLength);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+  std::vector<float> out_data(kMaxLag - kMinLag);
+  normalized_difference.Process(&data[0],
+                                data.size(),
+                                kMinLag,
+                                kMaxLag,
+                                &out_data[0]);
+
+  const unsigned int kIntegrationLength(kWindowLength - kMaxLag);
+  const float kEpsilon(1e-3f);
+  double difference_sum(0.0);
+  for (unsigned int lag(1); lag < kMaxLag; ++lag) {
+    double difference(0.0);
+    for (unsigned int i(0); i < kIntegrationLength; ++i) {
+      const double kDelta(static_cast<double>(data[i]) - data[i + lag]);
+      difference += kDelta * kDelta;
+    }
+    difference_sum += difference;
+    if (lag >= kMinLag) {
+      const double kExpected(difference * lag / difference_sum);
+      EXPECT_NEAR(kExpected, out_data[lag - kMinLag], kEpsilon);
+    }
+  }
+}
+
+/// @brief Check the CMNDF of a null signal
+TEST(NormalizedDifference, Null) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  NormalizedDifference normalized_difference(&manager);
+  const unsigned int kMinLag(manager.AnalysisParameters().min_lag);
+  const unsigned int kMaxLag(manager.AnalysisParameters().max_lag);
+
+  std::vector<float> data(manager.AnalysisParameters().window_length, 0.0f);
+  std::vector<float> out_data(kMaxLag - kMinLag);
+  normalized_difference.Process(&data[0],
+                                data.size(),
+                                kMinLag,
+                                kMaxLag,
+                                &out_data[0]);
+  for (unsigned int i(0); i < out_data.size(); ++i) {
+    EXPECT_EQ(1.0f, out_data[i]);
+  }
+}
@@ -0,0 +1,118 @@
+/// @file tests_pitchtracker.cc
+/// @brief Chartreuse streaming pitch tracker tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/pitchtracker.h"
+
+// Useful using declarations
+using chartreuse::algorithms::PitchTracker;
+using chartreuse::algorithms::kPitchTrackLatency;
+
+static const unsigned int kMinLag(32);
+static const unsigned int kMaxLag(768);
+
+/// @brief Helper: add a symmetric dip at the given period
+/// into a normalized difference
+static void AddDip(const unsigned int period,
+                   const float value,
+                   std::vector<float>* const normalized_difference) {
+  const unsigned int kIndex(period - kMinLag);
+  (*normalized_difference)[kIndex - 1] = 0.5f * (1.0f + value);
+  (*normalized_difference)[kIndex] = value;
+  (*normalized_difference)[kIndex + 1] = 0.5f * (1.0f + value);
+}
+
+/// @brief Sporadic octave errors (the lower octave being slightly better
+/// every few hops) should not change the tracked period
+TEST(PitchTracker, OctaveErrorRejection) {
+  const unsigned int kPeriod(100);
+  const unsigned int kHopsCount(64);
+  PitchTracker tracker;
+  for (unsigned int hop(0); hop < kHopsCount; ++hop) {
+    std::vector<float> normalized_difference(kMaxLag - kMinLag, 1.0f);
+    const bool kError(hop % 5 == 4);
+    AddDip(kPeriod, kError ? 0.15f : 0.05f, &normalized_difference);
+    AddDip(2 * kPeriod, kError ? 0.05f : 0.2f, &normalized_difference);
+    const float kActual(tracker.Process(&normalized_difference[0],
+                                        kMinLag,
+                                        kMaxLag));
+    EXPECT_EQ(static_cast<float>(kPeriod), kActual);
+  }
+}
+
+/// @brief Period multiples, even slightly deeper than the period itself,
+/// should never be tracked
+TEST(PitchTracker, SubharmonicRejection) {
+  const unsigned int kPeriod(60);
+  const unsigned int kHopsCount(64);
+  PitchTracker tracker;
+  for (unsigned int hop(0); hop < kHopsCount; ++hop) {
+    std::vector<float> normalized_difference(kMaxLag - kMinLag, 1.0f);
+    AddDip(kPeriod, 0.08f, &normalized_difference);
+    for (unsigned int multiple(2);
+         multiple * kPeriod + 1 < kMaxLag;
+         ++multiple) {
+      AddDip(multiple * kPeriod, 0.02f, &normalized_difference);
+    }
+    const float kActual(tracker.Process(&normalized_difference[0],
+                                        kMinLag,
+                                        kMaxLag));
+    EXPECT_EQ(static_cast<float>(kPeriod), kActual);
+  }
+}
+
+/// @brief Check the output latency on a sustained period change
+TEST(PitchTracker, Latency) {
+  const unsigned int kPeriod(100);
+  const unsigned int kNewPeriod(150);
+  const unsigned int kChangeHop(20);
+  const unsigned int kHopsCount(64);
+  PitchTracker tracker;
+  for (unsigned int hop(0); hop < kHopsCount; ++hop) {
+    std::vector<float> normalized_difference(kMaxLag - kMinLag, 1.0f);
+    AddDip(hop < kChangeHop ? kPeriod : kNewPeriod,
+           0.05f,
+           &normalized_difference);
+    const float kActual(tracker.Process(&normalized_difference[0],
+                                        kMinLag,
+                                        kMaxLag));
+    const float kExpected(hop < kChangeHop + kPitchTrackLatency
+                          ? static_cast<float>(kPeriod)
+                          : static_cast<float>(kNewPeriod));
+    EXPECT_EQ(kExpected, kActual);
+  }
+}
+
+/// @brief A reset tracker should behave as a newly built one
+TEST(PitchTracker, Reset) {
+  PitchTracker tracker;
+  PitchTracker reference;
+  std::vector<float> normalized_difference(kMaxLag - kMinLag, 1.0f);
+  AddDip(300, 0.05f, &normalized_difference);
+  for (unsigned int hop(0); hop < 2 * kPitchTrackLatency; ++hop) {
+    tracker.Process(&normalized_difference[0], kMinLag, kMaxLag);
+  }
+  tracker.Reset();
+  std::fill(normalized_difference.begin(), normalized_difference.end(), 1.0f);
+  AddDip(50, 0.05f, &normalized_difference);
+  EXPECT_EQ(reference.Process(&normalized_difference[0], kMinLag, kMaxLag),
+            tracker.Process(&normalized_difference[0], kMinLag, kMaxLag));
+}
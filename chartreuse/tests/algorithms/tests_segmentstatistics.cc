@@ -0,0 +1,100 @@
+/// @file tests_segmentstatistics.cc
+/// @brief Chartreuse segment statistics tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/segmentstatistics.h"
+
+// Using declarations for tested classes
+using chartreuse::algorithms::P2Quantile;
+using chartreuse::algorithms::SegmentStatistics;
+// Useful using declarations
+namespace Statistic = chartreuse::algorithms::Statistic;
+
+/// @brief Check all statistics of white noise observations against
+/// their offline computation
+TEST(SegmentStatistics, WhiteNoise) {
+  const unsigned int kDimensions(3);
+  const unsigned int kCount(4096);
+  const std::vector<float> kQuantiles = {0.1f, 0.5f, 0.9f};
+  SegmentStatistics statistics(kDimensions, kQuantiles);
+  const unsigned int kStride(Statistic::kCount + kQuantiles.size());
+  EXPECT_EQ(kDimensions * kStride, statistics.SummaryLength());
+
+  // Each dimension is scaled and shifted differently
+  std::vector<std::vector<float> > data(kDimensions);
+  for (unsigned int count(0); count < kCount; ++count) {
+    std::array<float, kDimensions> values;
+    for (unsigned int dimension(0); dimension < kDimensions; ++dimension) {
+      values[dimension] = kNormDistribution(kRandomGenerator) * (dimension + 1)
+                          + dimension;
+      data[dimension].push_back(values[dimension]);
+    }
+    statistics.Push(&values[0]);
+  }
+  EXPECT_EQ(kCount, statistics.Count());
+  std::vector<float> summary(statistics.SummaryLength());
+  statistics.Summary(&summary[0]);
+
+  for (unsigned int dimension(0); dimension < kDimensions; ++dimension) {
+    const std::vector<float>& values(data[dimension]);
+    const float* const actual(&summary[dimension * kStride]);
+    const double kMean(std::accumulate(values.begin(), values.end(), 0.0)
+                       / kCount);
+    double variance(0.0);
+    for (const float value : values) {
+      variance += (value - kMean) * (value - kMean);
+    }
+    variance /= kCount;
+    EXPECT_NEAR(kMean, actual[Statistic::kMean], 1e-4f);
+    EXPECT_NEAR(variance, actual[Statistic::kVariance], 1e-3f);
+    EXPECT_EQ(*std::min_element(values.begin(), values.end()),
+              actual[Statistic::kMin]);
+    EXPECT_EQ(*std::max_element(values.begin(), values.end()),
+              actual[Statistic::kMax]);
+    // Quantile estimations, within 2% of the data range
+    std::vector<float> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+    const float kTolerance(0.02f * (sorted.back() - sorted.front()));
+    for (unsigned int quantile_idx(0);
+         quantile_idx < kQuantiles.size();
+         ++quantile_idx) {
+      const float kExpected(sorted[static_cast<std::size_t>(
+        kQuantiles[quantile_idx] * (kCount - 1))]);
+      EXPECT_NEAR(kExpected,
+                  actual[Statistic::kCount + quantile_idx],
+                  kTolerance);
+    }
+  }
+  // Nothing left after a reset
+  statistics.Reset();
+  EXPECT_EQ(0u, statistics.Count());
+}
+
+/// @brief Check that the quantile is exact with less than 5 observations
+TEST(SegmentStatistics, P2QuantileFewObservations) {
+  P2Quantile median(0.5f);
+  EXPECT_EQ(0.0f, median.Value());
+  median.Push(3.0f);
+  EXPECT_EQ(3.0f, median.Value());
+  median.Push(1.0f);
+  median.Push(2.0f);
+  EXPECT_EQ(2.0f, median.Value());
+}
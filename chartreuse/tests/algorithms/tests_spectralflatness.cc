@@ -0,0 +1,143 @@
+/// @file tests_spectralflatness.cc
+/// @brief Chartreuse spectral flatness tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/spectralflatness.h"
+
+// Using declarations for tested classes
+using chartreuse::algorithms::FastLogTwo;
+using chartreuse::algorithms::FlatnessBands;
+// Useful using declarations
+using chartreuse::algorithms::kFastLogTwoMaxError;
+
+/// @brief Check the fast log2 approximation error bound over a wide range
+TEST(SpectralFlatness, FastLogTwoError) {
+  float max_error(0.0f);
+  for (float value(1e-30f); value < 1e30f; value *= 1.0001f) {
+    const float kExpected(static_cast<float>(std::log2(
+      static_cast<double>(value))));
+    max_error = std::max(max_error, std::fabs(FastLogTwo(value) - kExpected));
+  }
+  EXPECT_GE(kFastLogTwoMaxError, max_error);
+}
+
+/// @brief Check the vectorized version error bound against std::log2,
+/// over the whole range of powers (from the floor) to be found in bands
+TEST(SpectralFlatness, FastLogTwoArrayError) {
+  std::vector<float> input;
+  for (float value(1e-10f); value < 1e10f; value *= 1.001f) {
+    input.push_back(value);
+  }
+  // Making sure the remainder is not a whole chunk
+  if (input.size() % 2 == 0) {
+    input.pop_back();
+  }
+  std::vector<float> output(input.size());
+  FastLogTwo(&input[0], input.size(), &output[0]);
+  float max_error(0.0f);
+  for (std::size_t i(0); i < input.size(); ++i) {
+    const float kExpected(static_cast<float>(std::log2(
+      static_cast<double>(input[i]))));
+    max_error = std::max(max_error, std::fabs(output[i] - kExpected));
+    // Same results as the scalar version
+    EXPECT_EQ(FastLogTwo(input[i]), output[i]);
+  }
+  EXPECT_GE(kFastLogTwoMaxError, max_error);
+}
+
+/// @brief A flat (or silent) spectrum gives unity flatness in all bands,
+/// a single peak in a band lowers it
+TEST(SpectralFlatness, FlatSpectrum) {
+  const unsigned int kDftLength(2048);
+  const FlatnessBands bands(0.25f,
+                            0.05f,
+                            250.0f,
+                            16000.0f,
+                            1e-10f,
+                            kDftLength,
+                            kSamplingFreq);
+  const unsigned int kBandsCount(bands.BandsCount());
+  EXPECT_EQ(24u, kBandsCount);
+  std::vector<float> spectrum(kDftLength / 2 + 1, 1.0f);
+  std::vector<float> output(kBandsCount);
+  bands.Process(&spectrum[0], &output[0]);
+  for (unsigned int band(0); band < kBandsCount; ++band) {
+    EXPECT_NEAR(1.0f, output[band], 1e-4f);
+  }
+
+  std::fill(spectrum.begin(), spectrum.end(), 0.0f);
+  bands.Process(&spectrum[0], &output[0]);
+  for (unsigned int band(0); band < kBandsCount; ++band) {
+    EXPECT_NEAR(1.0f, output[band], 1e-4f);
+  }
+
+  std::fill(spectrum.begin(), spectrum.end(), 1.0f);
+  // 1 kHz, within the 9th band
+  spectrum[1000 * kDftLength / static_cast<unsigned int>(kSamplingFreq)]
+    = 1000.0f;
+  bands.Process(&spectrum[0], &output[0]);
+  EXPECT_GT(0.5f, output[8]);
+  EXPECT_NEAR(1.0f, output[0], 1e-4f);
+}
+
+/// @brief Compare the flatness computed with the approximation against
+/// a reference double precision implementation
+TEST(SpectralFlatness, Reference) {
+  const unsigned int kDftLength(2048);
+  const float kOverlap(0.05f);
+  const float kFloor(1e-10f);
+  const FlatnessBands bands(0.25f,
+                            kOverlap,
+                            250.0f,
+                            16000.0f,
+                            kFloor,
+                            kDftLength,
+                            kSamplingFreq);
+  const unsigned int kBandsCount(bands.BandsCount());
+  std::vector<float> spectrum(kDftLength / 2 + 1);
+  std::generate(spectrum.begin(),
+                spectrum.end(),
+                [&] {
+                  const float kValue(kNormDistribution(kRandomGenerator));
+                  return kValue * kValue * 100.0f;
+                });
+  std::vector<float> output(kBandsCount);
+  bands.Process(&spectrum[0], &output[0]);
+  const double kBinWidth(kSamplingFreq / kDftLength);
+  for (unsigned int band(0); band < kBandsCount; ++band) {
+    const double kLow(250.0 * std::pow(2.0, band * 0.25) * (1.0 - kOverlap));
+    const double kHigh(250.0 * std::pow(2.0, (band + 1) * 0.25)
+                       * (1.0 + kOverlap));
+    double log_sum(0.0);
+    double sum(0.0);
+    unsigned int count(0);
+    for (unsigned int bin(static_cast<unsigned int>(std::ceil(kLow / kBinWidth)));
+         bin <= static_cast<unsigned int>(std::floor(kHigh / kBinWidth));
+         ++bin) {
+      const double kValue(std::max(spectrum[bin], kFloor));
+      log_sum += std::log(kValue);
+      sum += kValue;
+      count += 1;
+    }
+    const double kExpected(std::exp(log_sum / count) / (sum / count));
+    EXPECT_NEAR(kExpected, output[band], 1e-4);
+  }
+}
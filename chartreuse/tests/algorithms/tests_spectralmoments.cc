@@ -0,0 +1,169 @@
+/// @file tests_spectralmoments.cc
+/// @brief Chartreuse spectral moments algorithm tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/spectralmoments.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Useful using declarations
+using chartreuse::interface::Manager;
+using chartreuse::algorithms::SpectralMoments;
+using chartreuse::interface::DescriptorId::kSpectralMoments;
+using chartreuse::interface::DescriptorId::kSpectrogramPower;
+namespace SpectralMoment = chartreuse::algorithms::SpectralMoment;
+
+/// @brief Check output range for white noise
+TEST(SpectralMoments, WhiteNoise) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kSpectralMoments);
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    for (unsigned int desc_index(0);
+         desc_index < manager.GetDescriptorMeta(descriptor).out_dim;
+         ++desc_index) {
+      EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[desc_index]);
+      EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[desc_index]);
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief Check the single pass moments against a naive two-pass computation
+TEST(SpectralMoments, TwoPassConsistency) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  const Manager::Parameters& kParameters(manager.AnalysisParameters());
+  const unsigned int kBinsCount(kParameters.high_edge
+                                - kParameters.low_edge
+                                + 1);
+  const double kEpsilon(1e-4);
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* power(manager.GetDescriptor(kSpectrogramPower));
+    const float* scale(manager.FrequencyScale());
+    // Gather all low bins into the first one, as the kernel does
+    std::vector<double> weights(power + kParameters.low_edge - 1,
+                                power + kParameters.high_edge);
+    weights[0] = 0.5 * power[0];
+    for (unsigned int i(1); i < kParameters.low_edge; ++i) {
+      weights[0] += power[i];
+    }
+    double sum(0.0);
+    double centroid(0.0);
+    for (unsigned int i(0); i < kBinsCount; ++i) {
+      sum += weights[i];
+      centroid += weights[i] * scale[i];
+    }
+    centroid /= sum;
+    double moments[3] = {0.0, 0.0, 0.0};
+    for (unsigned int i(0); i < kBinsCount; ++i) {
+      const double kDeviation(scale[i] - centroid);
+      moments[0] += weights[i] * kDeviation * kDeviation;
+      moments[1] += weights[i] * kDeviation * kDeviation * kDeviation;
+      moments[2] += weights[i] * kDeviation * kDeviation
+                    * kDeviation * kDeviation;
+    }
+    const double kVariance(moments[0] / sum);
+    const double kSkewness(moments[1] / sum / std::pow(kVariance, 1.5));
+    const double kKurtosis(moments[2] / sum / (kVariance * kVariance));
+
+    const float* out_data(manager.GetDescriptor(kSpectralMoments));
+    EXPECT_NEAR(centroid, out_data[SpectralMoment::kCentroid], kEpsilon);
+    EXPECT_NEAR(std::sqrt(kVariance),
+                out_data[SpectralMoment::kSpread],
+                kEpsilon);
+    EXPECT_NEAR(kSkewness, out_data[SpectralMoment::kSkewness], kEpsilon);
+    EXPECT_NEAR(kKurtosis,
+                out_data[SpectralMoment::kKurtosis],
+                kEpsilon * kKurtosis);
+    index += frame.size();
+  }
+}
+
+/// @brief Performance test for computing a fixed length signal
+TEST(SpectralMoments, Perf) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kSpectralMoments);
+
+  std::size_t index(0);
+  // Computing the mean output prevents the compiler from optimizing out things
+  float mean(0.0f);
+  while (index < kDataPerfSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    mean += out_data[SpectralMoment::kSpread] * out_data[SpectralMoment::kSpread];
+    index += frame.size();
+  }
+  EXPECT_LE(-1.0f, mean);
+}
+
+/// @brief Compute many spectra moments in a single batch,
+/// compare with the spectrum by spectrum computation
+TEST(SpectralMoments, Batch) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  SpectralMoments moments(&manager);
+  const Manager::Parameters& kParameters(manager.AnalysisParameters());
+  const std::size_t kSpectrumLength(kParameters.dft_length / 2 + 1);
+  // Padded rows, and more frames than a single tile
+  const std::size_t kStride(kSpectrumLength + 7);
+  const std::size_t kFramesCount(37);
+  std::vector<float> data(kFramesCount * kStride);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return std::abs(kNormDistribution(kRandomGenerator));});
+
+  std::vector<float> out_data(kFramesCount * SpectralMoment::kCount);
+  moments.Process(&data[0], kFramesCount, kStride,
+                  manager.FrequencyScale(),
+                  kParameters.low_edge, kParameters.high_edge,
+                  &out_data[0]);
+  std::array<float, SpectralMoment::kCount> expected;
+  for (std::size_t frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+    moments.Process(&data[frame_idx * kStride],
+                    manager.FrequencyScale(),
+                    kParameters.low_edge, kParameters.high_edge,
+                    &expected[0]);
+    for (unsigned int i(0); i < SpectralMoment::kCount; ++i) {
+      EXPECT_NEAR(expected[i],
+                  out_data[frame_idx * SpectralMoment::kCount + i],
+                  1e-4f * (1.0f + std::abs(expected[i])));
+    }
+  }
+}
@@ -0,0 +1,64 @@
+/// @file tests_spectrumhistory.cc
+/// @brief Chartreuse spectrum history tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/spectrumhistory.h"
+
+// Using declarations for tested classes
+using chartreuse::algorithms::SpectrumHistory;
+
+/// @brief Push successive constant spectra, check that each age retrieves
+/// the right one along with its magnitudes
+TEST(SpectrumHistory, Ages) {
+  const unsigned int kSpectrumLength(16);
+  const unsigned int kDepth(3);
+  SpectrumHistory history(kSpectrumLength, kDepth);
+  EXPECT_FALSE(history.IsActive());
+  history.Activate();
+  EXPECT_TRUE(history.IsActive());
+
+  // Interleaved complex spectra, pushed value is (3 * idx, 4 * idx)
+  std::vector<float> spectrum(kSpectrumLength * 2);
+  const unsigned int kPushCount(7);
+  EXPECT_EQ(0u, history.Count());
+  for (unsigned int push_idx(1); push_idx <= kPushCount; ++push_idx) {
+    for (unsigned int bin(0); bin < kSpectrumLength; ++bin) {
+      spectrum[2 * bin] = 3.0f * push_idx;
+      spectrum[2 * bin + 1] = 4.0f * push_idx;
+    }
+    history.Push(&spectrum[0]);
+    EXPECT_EQ(std::min(push_idx, kDepth), history.Count());
+  }
+  for (unsigned int age(1); age <= kDepth; ++age) {
+    const float kExpected(static_cast<float>(kPushCount + 1 - age));
+    for (unsigned int bin(0); bin < kSpectrumLength; ++bin) {
+      EXPECT_EQ(3.0f * kExpected, history.Spectrum(age)[bin].real());
+      EXPECT_EQ(4.0f * kExpected, history.Spectrum(age)[bin].imag());
+      EXPECT_NEAR(5.0f * kExpected, history.Magnitudes(age)[bin], 1e-5f);
+      EXPECT_NEAR(std::log(1.0f + 5.0f * kExpected),
+                  history.LogMagnitudes(age)[bin],
+                  1e-5f);
+    }
+  }
+  history.Reset();
+  EXPECT_FALSE(history.IsActive());
+  EXPECT_EQ(0u, history.Count());
+}
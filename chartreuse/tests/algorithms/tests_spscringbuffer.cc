@@ -0,0 +1,86 @@
+/// @file tests_spscringbuffer.cc
+/// @brief Chartreuse lock-free ringbuffer tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <thread>
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/spscringbuffer.h"
+
+// Using declarations for tested class
+using chartreuse::algorithms::SpscRingBuffer;
+
+/// @brief Push and pop around the buffer end, check that operations
+/// which cannot be entirely done are not done at all
+TEST(SpscRingBuffer, WrapAround) {
+  const std::size_t kCapacity(8);
+  SpscRingBuffer ringbuf(kCapacity);
+  const std::array<float, 5> kInput = {{1.0f, 2.0f, 3.0f, 4.0f, 5.0f}};
+  std::array<float, 5> output;
+
+  for (unsigned int iteration(0); iteration < 4; ++iteration) {
+    EXPECT_TRUE(ringbuf.Push(&kInput[0], kInput.size()));
+    // Not enough room
+    EXPECT_FALSE(ringbuf.Push(&kInput[0], kInput.size()));
+    EXPECT_EQ(kInput.size(), ringbuf.Size());
+    EXPECT_TRUE(ringbuf.Pop(&output[0], output.size()));
+    for (unsigned int idx(0); idx < kInput.size(); ++idx) {
+      EXPECT_EQ(kInput[idx], output[idx]);
+    }
+    // Not enough elements
+    EXPECT_FALSE(ringbuf.Pop(&output[0], 1));
+    EXPECT_EQ(0u, ringbuf.Size());
+  }
+}
+
+/// @brief Push an increasing sequence from one thread, pop it from another
+/// one: check that nothing is lost nor reordered
+TEST(SpscRingBuffer, Threads) {
+  const std::size_t kCapacity(64);
+  const unsigned int kChunkSize(7);
+  const unsigned int kChunksCount(10000);
+  SpscRingBuffer ringbuf(kCapacity);
+
+  std::thread producer([&] {
+    std::array<float, kChunkSize> chunk;
+    for (unsigned int chunk_idx(0); chunk_idx < kChunksCount; ++chunk_idx) {
+      for (unsigned int idx(0); idx < kChunkSize; ++idx) {
+        chunk[idx] = static_cast<float>(chunk_idx * kChunkSize + idx);
+      }
+      while (!ringbuf.Push(&chunk[0], chunk.size())) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  unsigned int mismatches_count(0);
+  float expected(0.0f);
+  float value(0.0f);
+  while (expected < kChunksCount * kChunkSize) {
+    if (ringbuf.Pop(&value, 1)) {
+      mismatches_count += value != expected ? 1 : 0;
+      expected += 1.0f;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_EQ(0u, mismatches_count);
+  EXPECT_EQ(0u, ringbuf.Size());
+}
@@ -0,0 +1,78 @@
+/// @file tests_workspace.cc
+/// @brief Chartreuse scratch memory tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+// std::complex
+#include <complex>
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/workspace.h"
+
+// Using declarations for tested classes
+using chartreuse::algorithms::Workspace;
+using chartreuse::algorithms::kWorkspaceAlignment;
+
+/// @brief Borrow blocks within nested scopes, check that all memory is given
+/// back on scopes destruction and that blocks do not overlap
+TEST(Workspace, NestedScopes) {
+  const std::size_t kCapacity(64);
+  Workspace workspace(kCapacity);
+  EXPECT_EQ(kCapacity, workspace.Capacity());
+  EXPECT_EQ(0U, workspace.Used());
+  {
+    Workspace::Scope scope(&workspace);
+    float* const first(scope.Floats(3));
+    EXPECT_EQ(kWorkspaceAlignment, workspace.Used());
+    {
+      Workspace::Scope nested(&workspace);
+      std::complex<float>* const second(
+        nested.Borrow<std::complex<float> >(5));
+      EXPECT_EQ(reinterpret_cast<float*>(second), first + kWorkspaceAlignment);
+      EXPECT_EQ(kWorkspaceAlignment + 12, workspace.Used());
+    }
+    EXPECT_EQ(kWorkspaceAlignment, workspace.Used());
+    // The nested scope memory is reused
+    float* const third(scope.Floats(kCapacity - kWorkspaceAlignment));
+    EXPECT_EQ(first + kWorkspaceAlignment, third);
+    EXPECT_EQ(kCapacity, workspace.Used());
+  }
+  EXPECT_EQ(0U, workspace.Used());
+}
+
+/// @brief The peak usage has to be kept once memory is given back,
+/// each block being rounded up to the blocks granularity
+TEST(Workspace, PeakUsage) {
+  const std::size_t kCapacity(64);
+  Workspace workspace(kCapacity);
+  EXPECT_EQ(0U, workspace.Peak());
+  {
+    Workspace::Scope scope(&workspace);
+    scope.Floats(5);
+    scope.Floats(kWorkspaceAlignment);
+  }
+  {
+    Workspace::Scope scope(&workspace);
+    scope.Floats(1);
+  }
+  EXPECT_EQ(0U, workspace.Used());
+  EXPECT_EQ(Workspace::BlockLength(5) + kWorkspaceAlignment,
+            workspace.Peak());
+  EXPECT_EQ(2 * kWorkspaceAlignment, Workspace::BlockLength(5));
+}
@@ -25,6 +25,7 @@
 // Useful using declarations
 using chartreuse::interface::Manager;
 using chartreuse::interface::DescriptorId::kAudioFundamentalFrequency;
+using chartreuse::interface::PitchEstimator::kYin;
 
 /// @brief Compute the descriptor for a null signal,
 /// check its output
@@ -177,6 +178,67 @@ TEST(AudioFundamentalFrequency, Constant) {
   }
 }
 
+/// @brief Compute the descriptor with the YIN method for a pure sinusoid
+/// of an integer period, check the descriptor output
+TEST(AudioFundamentalFrequency, YinSin) {
+  const float kPeriod(100.0f);
+  const Manager::Parameters kParameters(kSamplingFreq,
+                                        2048,
+                                        62.5f,
+                                        1500.0f,
+                                        chartreuse::kHopSizeSamples,
+                                        3,
+                                        0.25f,
+                                        kYin);
+  Manager manager(kParameters);
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioFundamentalFrequency);
+
+  std::size_t index(0);
+  SinusGenerator generator(kSamplingFreq / kPeriod, kSamplingFreq);
+  while (index < kParameters.window_length + kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with sin data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return generator();});
+    manager.ProcessFrame(&frame[0], frame.size());
+    index += frame.size();
+    // Waiting for the whole window to be filled
+    if (index >= kParameters.window_length) {
+      const float* out_data(manager.GetDescriptor(descriptor));
+      EXPECT_NEAR(kPeriod, out_data[0], 0.1f);
+    }
+  }
+}
+
+/// @brief Compute the descriptor with the YIN method for an uniform white
+/// noise, check that its range lies within [out_min ; out_max]
+TEST(AudioFundamentalFrequency, YinWhiteNoise) {
+  Manager manager(Manager::Parameters(kSamplingFreq,
+                                      2048,
+                                      62.5f,
+                                      1500.0f,
+                                      chartreuse::kHopSizeSamples,
+                                      3,
+                                      0.25f,
+                                      kYin));
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioFundamentalFrequency);
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[0]);
+    EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[0]);
+    index += frame.size();
+  }
+}
+
 /// @brief Performance test for computing a fixed length signal
 TEST(AudioFundamentalFrequency, Perf) {
   Manager manager((Manager::Parameters(kSamplingFreq)));
@@ -20,10 +20,12 @@
 
 #include "chartreuse/tests/tests.h"
 
+#include "chartreuse/src/descriptors/audiopower.h"
 #include "chartreuse/src/interface/manager.h"
 
 // Useful using declarations
 using chartreuse::interface::Manager;
+using chartreuse::descriptors::AudioPower;
 using chartreuse::interface::DescriptorId::kAudioPower;
 
 /// @brief Compute the descriptor for a null signal,
@@ -198,3 +200,29 @@ TEST(AudioPower, Perf) {
   }
   EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, mean);
 }
+
+/// @brief Compute the descriptor for overlapping white noise frames
+/// in a single batch, compare with the frame by frame computation
+TEST(AudioPower, Batch) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  AudioPower descriptor(&manager);
+  const std::size_t kFrameLength(manager.AnalysisParameters().window_length);
+  const std::size_t kStride(manager.AnalysisParameters().hop_size_sample);
+  const std::size_t kFramesCount(8);
+  std::vector<float> data(kFrameLength + (kFramesCount - 1) * kStride);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+
+  // Outputs interleaved with other ones
+  const std::size_t kOutputStride(3);
+  std::vector<float> out_data(kOutputStride * kFramesCount, -1.0f);
+  descriptor.Process(&data[0], kFrameLength, kFramesCount, kStride,
+                     kOutputStride, &out_data[0]);
+  for (std::size_t frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+    float expected(0.0f);
+    descriptor.Process(&data[frame_idx * kStride], kFrameLength, &expected);
+    EXPECT_FLOAT_EQ(expected, out_data[kOutputStride * frame_idx]);
+    EXPECT_EQ(-1.0f, out_data[kOutputStride * frame_idx + 1]);
+  }
+}
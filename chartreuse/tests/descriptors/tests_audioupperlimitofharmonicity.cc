@@ -0,0 +1,295 @@
+/// @file tests_audioupperlimitofharmonicity.cc
+/// @brief Chartreuse AudioUpperLimitOfHarmonicity descriptor tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/descriptors/audioupperlimitofharmonicity.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Useful using declarations
+using chartreuse::interface::Manager;
+using chartreuse::interface::DescriptorId::kAudioUpperLimitOfHarmonicity;
+using chartreuse::descriptors::AudioUpperLimitOfHarmonicity;
+using chartreuse::descriptors::UpperLimitOfHarmonicityBin;
+
+/// @brief Compute the descriptor for a null signal,
+/// check its output
+TEST(AudioUpperLimitOfHarmonicity, Null) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioUpperLimitOfHarmonicity);
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::fill(frame.begin(),
+              frame.end(),
+              0.0f);
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    for (unsigned int desc_index(0);
+         desc_index < manager.GetDescriptorMeta(descriptor).out_dim;
+         ++desc_index) {
+      EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[desc_index]);
+      EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[desc_index]);
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief Compute the descriptor for an uniform white noise,
+/// check that its range lies within [out_min ; out_max]
+TEST(AudioUpperLimitOfHarmonicity, WhiteNoise) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioUpperLimitOfHarmonicity);
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    for (unsigned int desc_index(0);
+         desc_index < manager.GetDescriptorMeta(descriptor).out_dim;
+         ++desc_index) {
+      EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[desc_index]);
+      EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[desc_index]);
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief Compute the descriptor for a pure sinusoid,
+/// check that its range lies within [out_min ; out_max]
+TEST(AudioUpperLimitOfHarmonicity, Sin) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioUpperLimitOfHarmonicity);
+
+  std::size_t index(0);
+  const unsigned int kFrameLength(manager.AnalysisParameters().hop_size_sample);
+  while (index < kDataTestSetSize - 1) {
+    manager.ProcessFrame(&kInSin[index], kFrameLength);
+    const float* out_data(manager.GetDescriptor(descriptor));
+    for (unsigned int desc_index(0);
+         desc_index < manager.GetDescriptorMeta(descriptor).out_dim;
+         ++desc_index) {
+      EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[desc_index]);
+      EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[desc_index]);
+    }
+    index += kFrameLength;
+  }
+}
+
+/// @brief Compute the descriptor for a pure sinusoid of very low frequency,
+/// check the descriptor output
+TEST(AudioUpperLimitOfHarmonicity, LowFreq) {
+  const float kFrequency(1.0f);
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioUpperLimitOfHarmonicity);
+
+  std::size_t index(0);
+  SinusGenerator generator(kFrequency, kSamplingFreq);
+  while (index < kDataTestSetSize - 1) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with sin data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return generator();});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    for (unsigned int desc_index(0);
+         desc_index < manager.GetDescriptorMeta(descriptor).out_dim;
+         ++desc_index) {
+      EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[desc_index]);
+      EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[desc_index]);
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief Compute the descriptor for a pure sinusoid of very high frequency,
+/// check the descriptor output
+TEST(AudioUpperLimitOfHarmonicity, HighFreq) {
+  const float kFrequency((kSamplingFreq - 10.f) / 2.0f);
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioUpperLimitOfHarmonicity);
+
+  std::size_t index(0);
+  SinusGenerator generator(kFrequency, kSamplingFreq);
+  while (index < kDataTestSetSize - 1) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with sin data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return generator();});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    for (unsigned int desc_index(0);
+         desc_index < manager.GetDescriptorMeta(descriptor).out_dim;
+         ++desc_index) {
+      EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[desc_index]);
+      EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[desc_index]);
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief Compute the descriptor for a constant value,
+/// check that its range lies within [out_min ; out_max]
+TEST(AudioUpperLimitOfHarmonicity, Constant) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioUpperLimitOfHarmonicity);
+  const float kConstant(1.0f);
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize - 1) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with sin data
+    std::fill(frame.begin(),
+              frame.end(),
+              kConstant);
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    for (unsigned int desc_index(0);
+         desc_index < manager.GetDescriptorMeta(descriptor).out_dim;
+         ++desc_index) {
+      EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[desc_index]);
+      EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[desc_index]);
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief Performance test for computing a fixed length signal
+TEST(AudioUpperLimitOfHarmonicity, Perf) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kAudioUpperLimitOfHarmonicity);
+
+  std::size_t index(0);
+  // Computing the mean output prevents the compiler from optimizing out things
+  float mean(0.0f);
+  while (index < kDataPerfSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    mean += out_data[0] * out_data[0];
+    index += frame.size();
+  }
+  EXPECT_LE(-1.0f, mean);
+}
+
+/// @brief Check the single pass upper limit search against
+/// the reference quadratic implementation
+TEST(AudioUpperLimitOfHarmonicity, UpperLimitBinReference) {
+  const unsigned int kSpectrumLength(1025);
+  std::vector<float> signal_power(kSpectrumLength);
+  std::vector<float> residual_power(kSpectrumLength);
+  for (unsigned int iteration(0); iteration < 16; ++iteration) {
+    std::generate(signal_power.begin(),
+                  signal_power.end(),
+                  [&] {return std::fabs(kNormDistribution(kRandomGenerator));});
+    // Residual power relatively lower or higher than the signal one
+    const float kRatio(0.1f * iteration);
+    std::generate(residual_power.begin(),
+                  residual_power.end(),
+                  [&] {
+                    return kRatio
+                           * std::fabs(kNormDistribution(kRandomGenerator));
+                  });
+    unsigned int expected(0);
+    for (unsigned int low_limit(kSpectrumLength - 1);
+         low_limit > 0;
+         --low_limit) {
+      float signal_sum(0.0f);
+      float residual_sum(0.0f);
+      for (unsigned int i(kSpectrumLength - 1); i > low_limit; --i) {
+        signal_sum += signal_power[i];
+        residual_sum += residual_power[i];
+      }
+      if ((signal_sum > 0.0f) && (residual_sum / signal_sum < 0.5f)) {
+        expected = low_limit;
+        break;
+      }
+    }
+    EXPECT_EQ(expected, UpperLimitOfHarmonicityBin(&signal_power[0],
+                                                   &residual_power[0],
+                                                   kSpectrumLength));
+  }
+}
+
+/// @brief Check the descriptor against the reference implementation
+/// (scripts/audio_harmonicity.py) output, for harmonic tones of the given lag
+/// and harmonics count above which lies dense inharmonic content
+TEST(AudioUpperLimitOfHarmonicity, PythonReference) {
+  struct Reference {
+    unsigned int lag;
+    unsigned int harmonics_count;
+    double inharmonic_edge;
+    float expected;
+  };
+  const std::array<Reference, 6> kReferences = {{
+    {96, 3, 1500.0, 1000.0f},
+    {60, 6, 4000.0, 4000.0f},
+    {96, 6, 4000.0, 16000.0f},
+    {150, 3, 16000.0, 1000.0f},
+    {150, 6, 16000.0, 2000.0f},
+    {150, 24, 16000.0, 8000.0f}
+  }};
+  const double kPi(3.14159265358979323846);
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  AudioUpperLimitOfHarmonicity descriptor(&manager);
+  const unsigned int kWindowLength(
+    manager.AnalysisParameters().window_length);
+  const unsigned int kFrameLength(
+    manager.AnalysisParameters().hop_size_sample);
+  std::vector<float> window(kWindowLength);
+  for (const Reference& reference : kReferences) {
+    for (unsigned int i(0); i < kWindowLength; ++i) {
+      double value(0.0);
+      for (unsigned int k(1); k <= reference.harmonics_count; ++k) {
+        value += std::sin(2.0 * kPi * k * i / reference.lag + 0.3 * k);
+      }
+      // Inharmonic partials, up to the Nyquist frequency
+      unsigned int k(0);
+      for (double freq(reference.inharmonic_edge);
+           freq < 23500.0;
+           freq += 211.0 * std::sqrt(2.0)) {
+        value += 0.1 * std::sin(2.0 * kPi * freq * i / kSamplingFreq
+                                + 0.7 * k);
+        k += 1;
+      }
+      window[i] = static_cast<float>(value);
+    }
+    float output(0.0f);
+    descriptor.Process(&window[0],
+                       kWindowLength,
+                       kFrameLength,
+                       static_cast<float>(reference.lag),
+                       &output);
+    EXPECT_EQ(reference.expected, output);
+  }
+}
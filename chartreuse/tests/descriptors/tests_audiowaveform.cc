@@ -20,10 +20,12 @@
 
 #include "chartreuse/tests/tests.h"
 
+#include "chartreuse/src/descriptors/audiowaveform.h"
 #include "chartreuse/src/interface/manager.h"
 
 // Useful using declarations
 using chartreuse::interface::Manager;
+using chartreuse::descriptors::AudioWaveform;
 using chartreuse::interface::DescriptorId::kAudioWaveform;
 
 /// @brief Compute the descriptor for a null signal,
@@ -198,3 +200,30 @@ TEST(AudioWaveform, Perf) {
   }
   EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, mean);
 }
+
+/// @brief Compute the descriptor for overlapping white noise frames
+/// in a single batch, compare with the frame by frame computation
+TEST(AudioWaveform, Batch) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  AudioWaveform descriptor(&manager);
+  const std::size_t kFrameLength(manager.AnalysisParameters().window_length);
+  const std::size_t kStride(manager.AnalysisParameters().hop_size_sample);
+  const std::size_t kFramesCount(8);
+  std::vector<float> data(kFrameLength + (kFramesCount - 1) * kStride);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+
+  // Outputs interleaved with other ones
+  const std::size_t kOutputStride(3);
+  std::vector<float> out_data(kOutputStride * kFramesCount, 2.0f);
+  descriptor.Process(&data[0], kFrameLength, kFramesCount, kStride,
+                     kOutputStride, &out_data[0]);
+  for (std::size_t frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+    float expected[2];
+    descriptor.Process(&data[frame_idx * kStride], kFrameLength, &expected[0]);
+    EXPECT_EQ(expected[0], out_data[kOutputStride * frame_idx]);
+    EXPECT_EQ(expected[1], out_data[kOutputStride * frame_idx + 1]);
+    EXPECT_EQ(2.0f, out_data[kOutputStride * frame_idx + 2]);
+  }
+}
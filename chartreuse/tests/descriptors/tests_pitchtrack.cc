@@ -0,0 +1,103 @@
+/// @file tests_pitchtrack.cc
+/// @brief Chartreuse PitchTrack descriptor tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/pitchtracker.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Useful using declarations
+using chartreuse::interface::Manager;
+using chartreuse::interface::DescriptorId::kPitchTrack;
+using chartreuse::algorithms::kPitchTrackLatency;
+
+/// @brief Compute the descriptor for an uniform white noise,
+/// check that its range lies within [out_min ; out_max]
+TEST(PitchTrack, WhiteNoise) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kPitchTrack);
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    const float* out_data(manager.GetDescriptor(descriptor));
+    EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[0]);
+    EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[0]);
+    index += frame.size();
+  }
+}
+
+/// @brief Compute the descriptor for a pure sinusoid,
+/// check that its range lies within [out_min ; out_max]
+TEST(PitchTrack, Sin) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  chartreuse::interface::DescriptorId::Type descriptor(kPitchTrack);
+
+  std::size_t index(0);
+  const unsigned int kFrameLength(manager.AnalysisParameters().hop_size_sample);
+  while (index < kDataTestSetSize - 1) {
+    manager.ProcessFrame(&kInSin[index], kFrameLength);
+    const float* out_data(manager.GetDescriptor(descriptor));
+    EXPECT_GE(manager.GetDescriptorMeta(descriptor).out_max, out_data[0]);
+    EXPECT_LE(manager.GetDescriptorMeta(descriptor).out_min, out_data[0]);
+    index += kFrameLength;
+  }
+}
+
+/// @brief Track harmonic tones, check the tracked period against
+/// the actual one once the overlap and the tracker latency are filled
+TEST(PitchTrack, HarmonicTones) {
+  const std::array<float, 8> kFundamentals = {{
+    110.0f, 220.0f, 440.0f, 600.0f, 700.0f, 800.0f, 1000.0f, 1200.0f
+  }};
+  const double kPi(3.14159265358979323846);
+  const unsigned int kHopsCount(32);
+  for (const float fundamental : kFundamentals) {
+    Manager manager((Manager::Parameters(kSamplingFreq)));
+    const unsigned int kFrameLength(
+      manager.AnalysisParameters().hop_size_sample);
+    const unsigned int kSettlingHops(manager.AnalysisParameters().overlap
+                                     + kPitchTrackLatency);
+    const float kExpected(kSamplingFreq / fundamental);
+    std::vector<float> frame(kFrameLength);
+    for (unsigned int hop(0); hop < kHopsCount; ++hop) {
+      for (unsigned int i(0); i < kFrameLength; ++i) {
+        const double kTime((hop * kFrameLength + i) / kSamplingFreq);
+        double value(0.0);
+        for (unsigned int k(1); k * fundamental < 20000.0f; ++k) {
+          value += std::sin(2.0 * kPi * k * fundamental * kTime + 0.5 * k)
+                   / k;
+        }
+        frame[i] = static_cast<float>(0.5 * value);
+      }
+      manager.ProcessFrame(&frame[0], kFrameLength);
+      const float kActual(*manager.GetDescriptor(kPitchTrack));
+      if (hop >= kSettlingHops) {
+        EXPECT_NEAR(kExpected, kActual, 0.01f * kExpected)
+          << "f0: " << fundamental << ", hop: " << hop;
+      }
+    }
+  }
+}
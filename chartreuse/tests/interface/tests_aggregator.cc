@@ -0,0 +1,76 @@
+/// @file tests_aggregator.cc
+/// @brief Chartreuse aggregator class tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/interface/aggregator.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Using declarations for tested class
+using chartreuse::interface::Aggregator;
+// Using declarations for related classes
+using chartreuse::interface::Manager;
+using chartreuse::interface::DescriptorId::kAudioPower;
+using chartreuse::interface::DescriptorId::kMFCC;
+using chartreuse::interface::DescriptorId::Type;
+namespace Statistic = chartreuse::algorithms::Statistic;
+
+/// @brief Summarize descriptors for white noise over texture windows:
+/// check the windows count and their summaries against the raw descriptors
+TEST(Aggregator, WhiteNoise) {
+  const unsigned int kTextureLength(10);
+  const unsigned int kTexturesCount(5);
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  const std::vector<Type> kDescriptors = {kAudioPower, kMFCC};
+  const std::vector<float> kQuantiles = {0.5f};
+  Aggregator aggregator(&manager, kDescriptors, kTextureLength, kQuantiles);
+  const unsigned int kStride(Statistic::kCount + kQuantiles.size());
+  EXPECT_EQ((1 + manager.GetDescriptorMeta(kMFCC).out_dim) * kStride,
+            aggregator.SummaryLength());
+
+  unsigned int textures_count(0);
+  std::vector<float> powers;
+  for (unsigned int frame_idx(0);
+       frame_idx < kTextureLength * kTexturesCount;
+       ++frame_idx) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    powers.push_back(manager.GetDescriptor(kAudioPower)[0]);
+    if (aggregator.Process()) {
+      textures_count += 1;
+      EXPECT_EQ(kTextureLength, powers.size());
+      const float* summary(aggregator.Summary());
+      const float kMean(std::accumulate(powers.begin(), powers.end(), 0.0f)
+                        / powers.size());
+      EXPECT_NEAR(kMean, summary[Statistic::kMean], 1e-5f);
+      EXPECT_EQ(*std::min_element(powers.begin(), powers.end()),
+                summary[Statistic::kMin]);
+      EXPECT_EQ(*std::max_element(powers.begin(), powers.end()),
+                summary[Statistic::kMax]);
+      powers.clear();
+    }
+  }
+  EXPECT_EQ(kTexturesCount, textures_count);
+  // Nothing left to flush
+  EXPECT_FALSE(aggregator.Flush());
+}
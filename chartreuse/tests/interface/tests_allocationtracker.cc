@@ -0,0 +1,80 @@
+/// @file tests_allocationtracker.cc
+/// @brief Chartreuse allocation tracking tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/interface/allocationtracker.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Using declarations for tested class
+using chartreuse::interface::AllocationTracker;
+// Using declarations for related classes
+using chartreuse::interface::Manager;
+using chartreuse::interface::DescriptorId::kCount;
+using chartreuse::interface::DescriptorId::Type;
+namespace AllocationPolicy = chartreuse::interface::AllocationPolicy;
+
+/// @brief Check that allocations are actually tracked
+TEST(AllocationTracker, Report) {
+  std::size_t allocations_count(0);
+  {
+    AllocationTracker tracker(AllocationPolicy::kReport);
+    std::vector<float> data(kDataTestSetSize);
+    allocations_count = tracker.AllocationsCount();
+  }
+  if (AllocationTracker::IsAvailable()) {
+    EXPECT_LE(1u, allocations_count);
+  } else {
+    EXPECT_EQ(0u, allocations_count);
+  }
+}
+
+/// @brief For each descriptor, check that no allocation happens
+/// within the processing path once the manager is set up
+///
+/// Only relevant when allocations tracking is built.
+TEST(AllocationTracker, DescriptorsRealTimeSafety) {
+  const unsigned int kWarmUpFramesCount(4);
+  const unsigned int kFramesCount(8);
+  for (unsigned int descriptor_idx(0);
+       descriptor_idx < kCount;
+       ++descriptor_idx) {
+    const Type descriptor(static_cast<Type>(descriptor_idx));
+    Manager manager((Manager::Parameters(kSamplingFreq)));
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    for (unsigned int frame_idx(0);
+         frame_idx < kWarmUpFramesCount + kFramesCount;
+         ++frame_idx) {
+      std::generate(frame.begin(),
+                    frame.end(),
+                    [&] {return kNormDistribution(kRandomGenerator);});
+      std::size_t allocations_count(0);
+      {
+        AllocationTracker tracker(AllocationPolicy::kReport);
+        manager.ProcessFrame(&frame[0], frame.size());
+        manager.GetDescriptor(descriptor);
+        allocations_count = tracker.AllocationsCount();
+      }
+      if (frame_idx >= kWarmUpFramesCount) {
+        EXPECT_EQ(0u, allocations_count) << "descriptor " << descriptor_idx;
+      }
+    }
+  }
+}
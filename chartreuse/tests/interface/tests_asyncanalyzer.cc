@@ -0,0 +1,137 @@
+/// @file tests_asyncanalyzer.cc
+/// @brief Chartreuse asynchronous analyzer class tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <chrono>
+#include <thread>
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/interface/asyncanalyzer.h"
+#include "chartreuse/src/interface/manager.h"
+
+// Using declarations for tested class
+using chartreuse::interface::AsyncAnalyzer;
+// Using declarations for related classes
+using chartreuse::interface::Manager;
+using chartreuse::interface::kAvailableDescriptors;
+using chartreuse::interface::kAvailableDescriptorsCount;
+using chartreuse::descriptors::Descriptor_Meta;
+
+/// @brief Feed white noise by chunks of arbitrary length:
+/// check that all subframes descriptors are retrieved,
+/// identical to those directly computed by a manager
+TEST(AsyncAnalyzer, WhiteNoise) {
+  const unsigned int kChunkLength(130);
+  const unsigned int kSubframesCount(32);
+  const unsigned int kDataLength(kSubframesCount * chartreuse::kHopSizeSamples);
+  std::vector<float> data(kDataLength);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+
+  // Expected output
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  std::vector<float> expected;
+  for (unsigned int subframe(0); subframe < kSubframesCount; ++subframe) {
+    manager.ProcessFrame(&data[subframe * chartreuse::kHopSizeSamples],
+                         chartreuse::kHopSizeSamples);
+    for (const auto descriptor : kAvailableDescriptors) {
+      const Descriptor_Meta& kMeta(manager.GetDescriptorMeta(descriptor));
+      expected.push_back((*manager.GetDescriptor(descriptor) - kMeta.out_min)
+                         / (kMeta.out_max - kMeta.out_min));
+    }
+  }
+
+  AsyncAnalyzer analyzer(kSamplingFreq, kSubframesCount);
+  std::size_t index(0);
+  while (index < kDataLength) {
+    const unsigned int kLength(static_cast<unsigned int>(
+      std::min(static_cast<std::size_t>(kChunkLength), kDataLength - index)));
+    EXPECT_TRUE(analyzer.Push(&data[index], kLength));
+    index += kLength;
+  }
+  std::vector<float> output(kSubframesCount * kAvailableDescriptorsCount);
+  unsigned int retrieved_count(0);
+  // Waiting for the worker, with a timeout
+  for (unsigned int attempt(0);
+       (attempt < 1000) && (retrieved_count < kSubframesCount);
+       ++attempt) {
+    retrieved_count += analyzer.Retrieve(
+      &output[retrieved_count * kAvailableDescriptorsCount],
+      kSubframesCount - retrieved_count);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(kSubframesCount, retrieved_count);
+  EXPECT_EQ(0u, analyzer.PendingSamples());
+  for (unsigned int idx(0); idx < output.size(); ++idx) {
+    EXPECT_FLOAT_EQ(expected[idx], output[idx]);
+  }
+}
+
+/// @brief Feed more subframes than the queues capacity, one hop at a time:
+/// the worker, blocked on its full output queue, has to be woken up
+/// by each retrieval
+TEST(AsyncAnalyzer, FullOutputQueue) {
+  const unsigned int kCapacity(2);
+  const unsigned int kSubframesCount(16);
+  const unsigned int kDataLength(kSubframesCount * chartreuse::kHopSizeSamples);
+  std::vector<float> data(kDataLength);
+  std::generate(data.begin(),
+                data.end(),
+                [&] {return kNormDistribution(kRandomGenerator);});
+
+  // Expected output
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  std::vector<float> expected;
+  for (unsigned int subframe(0); subframe < kSubframesCount; ++subframe) {
+    manager.ProcessFrame(&data[subframe * chartreuse::kHopSizeSamples],
+                         chartreuse::kHopSizeSamples);
+    for (const auto descriptor : kAvailableDescriptors) {
+      const Descriptor_Meta& kMeta(manager.GetDescriptorMeta(descriptor));
+      expected.push_back((*manager.GetDescriptor(descriptor) - kMeta.out_min)
+                         / (kMeta.out_max - kMeta.out_min));
+    }
+  }
+
+  AsyncAnalyzer analyzer(kSamplingFreq, kCapacity);
+  std::vector<float> output(kSubframesCount * kAvailableDescriptorsCount);
+  unsigned int pushed_count(0);
+  unsigned int retrieved_count(0);
+  // Waiting for the worker, with a timeout
+  for (unsigned int attempt(0);
+       (attempt < 10000) && (retrieved_count < kSubframesCount);
+       ++attempt) {
+    if ((pushed_count < kSubframesCount)
+        && analyzer.Push(&data[pushed_count * chartreuse::kHopSizeSamples],
+                         chartreuse::kHopSizeSamples)) {
+      pushed_count += 1;
+    } else {
+      // Only retrieving once the queues are full
+      retrieved_count += analyzer.Retrieve(
+        &output[retrieved_count * kAvailableDescriptorsCount],
+        1);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(kSubframesCount, retrieved_count);
+  for (unsigned int idx(0); idx < output.size(); ++idx) {
+    EXPECT_FLOAT_EQ(expected[idx], output[idx]);
+  }
+}
@@ -0,0 +1,124 @@
+/// @file tests_descriptorset.cc
+/// @brief Chartreuse compile-time descriptors set tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/algorithms/spectralmoments.h"
+#include "chartreuse/src/interface/analysiscontext.h"
+#include "chartreuse/src/interface/descriptorset.h"
+
+// Using declarations for tested class
+using chartreuse::interface::DescriptorSet;
+// Using declarations for related classes
+using chartreuse::interface::Manager;
+namespace DescriptorId = chartreuse::interface::DescriptorId;
+
+/// @brief Check the set packed output against descriptors retrieved
+/// one by one from an independent manager
+TEST(DescriptorSet, PackedOutput) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  Manager reference((Manager::Parameters(kSamplingFreq)));
+  // Power spectrum based descriptors first: moments have to be fused anyway
+  DescriptorSet<DescriptorId::kAudioPower,
+                DescriptorId::kAudioSpectrumFlatness,
+                DescriptorId::kAudioSpectrumCentroid,
+                DescriptorId::kAudioSpectrumSpread,
+                DescriptorId::kMFCC> descriptor_set(&manager);
+  const DescriptorId::Type kDescriptors[] = {
+    DescriptorId::kAudioPower,
+    DescriptorId::kAudioSpectrumFlatness,
+    DescriptorId::kAudioSpectrumCentroid,
+    DescriptorId::kAudioSpectrumSpread,
+    DescriptorId::kMFCC
+  };
+  std::size_t expected_size(0);
+  for (const DescriptorId::Type descriptor : kDescriptors) {
+    expected_size += reference.GetDescriptorMeta(descriptor).out_dim;
+  }
+  ASSERT_EQ(expected_size, descriptor_set.OutputSize());
+  std::vector<float> output(descriptor_set.OutputSize());
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    descriptor_set.Process(&frame[0], frame.size(), &output[0]);
+    reference.ProcessFrame(&frame[0], frame.size());
+    const float* current_out(&output[0]);
+    for (const DescriptorId::Type descriptor : kDescriptors) {
+      const unsigned int kDim(reference.GetDescriptorMeta(descriptor).out_dim);
+      const float* expected(reference.GetDescriptor(descriptor));
+      for (unsigned int desc_index(0); desc_index < kDim; ++desc_index) {
+        EXPECT_EQ(expected[desc_index], current_out[desc_index]);
+      }
+      current_out += kDim;
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief The fused kernel has to give the same power spectrum and moments
+/// as the separate ones
+TEST(DescriptorSet, FusedMoments) {
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  const Manager::Parameters& kParameters(manager.AnalysisParameters());
+  const unsigned int kSpectrumLength(kParameters.dft_length / 2 + 1);
+  std::vector<float> power(kSpectrumLength);
+  std::vector<float> moments(chartreuse::algorithms::SpectralMoment::kCount);
+  std::vector<float> expected_moments(moments.size());
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    chartreuse::algorithms::ComputeSpectrumPowerAndMoments(
+      manager.GetDescriptor(DescriptorId::kDft),
+      kSpectrumLength,
+      manager.FrequencyScale(),
+      kParameters.low_edge,
+      kParameters.high_edge,
+      manager.Context().SpectrumNormalization(),
+      &power[0],
+      &moments[0]);
+    const float* expected_power(
+      manager.GetDescriptor(DescriptorId::kSpectrogramPower));
+    for (unsigned int bin(0); bin < kSpectrumLength; ++bin) {
+      EXPECT_EQ(expected_power[bin], power[bin]);
+    }
+    chartreuse::algorithms::ComputeSpectralMoments(
+      expected_power,
+      manager.FrequencyScale(),
+      kParameters.low_edge,
+      kParameters.high_edge,
+      manager.Context().SpectrumNormalization(),
+      &expected_moments[0]);
+    for (unsigned int moment(0); moment < moments.size(); ++moment) {
+      EXPECT_EQ(expected_moments[moment], moments[moment]);
+    }
+    index += frame.size();
+  }
+}
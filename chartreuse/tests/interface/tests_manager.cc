@@ -26,6 +26,7 @@
 using chartreuse::interface::Manager;
 // Using declarations for related classes
 using chartreuse::interface::DescriptorId::kCount;
+using chartreuse::interface::PitchEstimator::kAutoCorrelation;
 using chartreuse::interface::DescriptorId::Type;
 using chartreuse::descriptors::Descriptor_Meta;
 
@@ -65,6 +66,38 @@ TEST(Manager, WhiteNoise) {
   }
 }
 
+/// @brief Compute each descriptor alone (along with its dependencies)
+/// for white noise: its scratch memory peak usage has to fit into the
+/// workspace, the most demanding one using all of it
+TEST(Manager, WorkspacePeakUsage) {
+  const float kSamplingFreq(48000.0f);
+  const unsigned int kFramesCount(8);
+
+  std::size_t highest_peak(0);
+  std::size_t capacity(0);
+  for (unsigned int descriptor_idx(0);
+       descriptor_idx < kCount;
+       ++descriptor_idx) {
+    const Type descriptor(static_cast<Type>(descriptor_idx));
+    Manager manager((Manager::Parameters(kSamplingFreq)));
+    manager.EnableDescriptor(descriptor, true);
+    for (unsigned int frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+      std::array<float, chartreuse::kHopSizeSamples> frame;
+      std::generate(frame.begin(),
+                    frame.end(),
+                    [&] {return kNormDistribution(kRandomGenerator);});
+      manager.ProcessFrame(&frame[0], frame.size());
+      manager.GetDescriptor(descriptor);
+    }
+    const std::size_t kPeak(manager.Scratch().Peak());
+    capacity = manager.Scratch().Capacity();
+    EXPECT_LE(kPeak, capacity) << "descriptor " << descriptor_idx;
+    EXPECT_EQ(0u, manager.Scratch().Used());
+    highest_peak = std::max(highest_peak, kPeak);
+  }
+  EXPECT_EQ(capacity, highest_peak);
+}
+
 /// @brief Compute all descriptors for white noise
 TEST(Manager, Perf) {
   const float kSamplingFreq(48000.0f);
@@ -89,3 +122,254 @@ TEST(Manager, Perf) {
     index += frame.size();
   }
 }
+
+/// @brief Check that managers sharing an analysis context behave exactly as
+/// independent ones
+TEST(Manager, SharedContext) {
+  const float kSamplingFreq(48000.0f);
+
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  Manager shared_manager(manager.SharedContext());
+  Manager other_manager((Manager::Parameters(kSamplingFreq)));
+
+  EXPECT_EQ(&manager.Context(), &shared_manager.Context());
+  EXPECT_NE(&manager.Context(), &other_manager.Context());
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    shared_manager.ProcessFrame(&frame[0], frame.size());
+    other_manager.ProcessFrame(&frame[0], frame.size());
+    for (unsigned int descriptor_idx(0);
+         descriptor_idx < kCount;
+         ++descriptor_idx) {
+      const Type descriptor(static_cast<Type>(descriptor_idx));
+      const unsigned int kDim(shared_manager.GetDescriptorMeta(descriptor).out_dim);
+      const float* shared_data(shared_manager.GetDescriptor(descriptor));
+      const float* other_data(other_manager.GetDescriptor(descriptor));
+      for (unsigned int desc_index(0); desc_index < kDim; ++desc_index) {
+        EXPECT_EQ(other_data[desc_index], shared_data[desc_index]);
+      }
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief Feed both managers with the same random frames,
+/// check that all descriptors are equal for each of them
+static void ExpectSameOutput(Manager* const manager,
+                             Manager* const reference,
+                             const std::size_t length) {
+  std::size_t index(0);
+  while (index < length) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager->ProcessFrame(&frame[0], frame.size());
+    reference->ProcessFrame(&frame[0], frame.size());
+    for (unsigned int descriptor_idx(0);
+         descriptor_idx < kCount;
+         ++descriptor_idx) {
+      const Type descriptor(static_cast<Type>(descriptor_idx));
+      const unsigned int kDim(manager->GetDescriptorMeta(descriptor).out_dim);
+      const float* data(manager->GetDescriptor(descriptor));
+      const float* reference_data(reference->GetDescriptor(descriptor));
+      for (unsigned int desc_index(0); desc_index < kDim; ++desc_index) {
+        EXPECT_EQ(reference_data[desc_index], data[desc_index]);
+      }
+    }
+    index += frame.size();
+  }
+}
+
+/// @brief Clone a manager in the middle of a signal: both have to behave
+/// exactly the same afterwards, stateful descriptors included
+TEST(Manager, Clone) {
+  const float kSamplingFreq(48000.0f);
+
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  Manager other_manager((Manager::Parameters(kSamplingFreq)));
+  ExpectSameOutput(&manager, &other_manager, kDataTestSetSize);
+
+  std::unique_ptr<Manager> clone(manager.Clone());
+  EXPECT_EQ(&manager.Context(), &clone->Context());
+  ExpectSameOutput(clone.get(), &manager, kDataTestSetSize);
+}
+
+/// @brief A reset manager has to behave exactly as a just-constructed one
+TEST(Manager, Reset) {
+  const float kSamplingFreq(48000.0f);
+
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  Manager other_manager((Manager::Parameters(kSamplingFreq)));
+  ExpectSameOutput(&manager, &other_manager, kDataTestSetSize);
+
+  manager.Reset();
+  for (unsigned int descriptor_idx(0);
+       descriptor_idx < kCount;
+       ++descriptor_idx) {
+    EXPECT_FALSE(manager.IsDescriptorComputed(
+      static_cast<Type>(descriptor_idx)));
+  }
+  Manager fresh_manager(manager.SharedContext());
+  ExpectSameOutput(&manager, &fresh_manager, kDataTestSetSize);
+}
+
+/// @brief Feed an externally framed manager with the windows of an internally
+/// framed one, through a single buffer overwritten as soon as each frame
+/// has been analysed: all descriptors have to be equal for both of them
+TEST(Manager, ExternalWindowReuse) {
+  const float kSamplingFreq(48000.0f);
+
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  Manager external(manager.SharedContext(),
+                   true,
+                   chartreuse::interface::Framing::kExternal);
+  const std::size_t kWindowLength(
+    manager.AnalysisParameters().window_length);
+  std::vector<float> window(kWindowLength);
+  std::size_t index(0);
+  while (index < kDataTestSetSize) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    std::copy_n(manager.CurrentWindow(), kWindowLength, window.begin());
+    external.ProcessWindow(&frame[0], frame.size(), &window[0]);
+    for (unsigned int descriptor_idx(0);
+         descriptor_idx < kCount;
+         ++descriptor_idx) {
+      const Type descriptor(static_cast<Type>(descriptor_idx));
+      const unsigned int kDim(manager.GetDescriptorMeta(descriptor).out_dim);
+      const float* data(external.GetDescriptor(descriptor));
+      const float* reference_data(manager.GetDescriptor(descriptor));
+      for (unsigned int desc_index(0); desc_index < kDim; ++desc_index) {
+        EXPECT_EQ(reference_data[desc_index], data[desc_index]);
+      }
+    }
+    // The caller reuses its buffer
+    std::fill(window.begin(), window.end(), 1e6f);
+    index += frame.size();
+  }
+}
+
+/// @brief Enabled stateful descriptors retrieved every few frames only
+/// have to output the same as when retrieved for every frame,
+/// their timing included
+TEST(Manager, StatefulSparseRetrieval) {
+  const float kSamplingFreq(48000.0f);
+  const std::array<Type, 4> kStateful = {{
+    chartreuse::interface::DescriptorId::kSignalEnvelope,
+    chartreuse::interface::DescriptorId::kLogAttackTime,
+    chartreuse::interface::DescriptorId::kTemporalCentroid,
+    chartreuse::interface::DescriptorId::kPitchTrack
+  }};
+  const unsigned int kRetrievalPeriod(5);
+  const unsigned int kFramesCount(64);
+
+  Manager manager((Manager::Parameters(kSamplingFreq)));
+  Manager reference((Manager::Parameters(kSamplingFreq)));
+  for (const Type descriptor : kStateful) {
+    manager.EnableDescriptor(descriptor, true);
+    reference.EnableDescriptor(descriptor, true);
+  }
+  for (unsigned int frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Random data fading in: the attack lasts for several frames
+    const float kGain(std::min(1.0f, frame_idx / 32.0f));
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kGain * kNormDistribution(kRandomGenerator);});
+    manager.ProcessFrame(&frame[0], frame.size());
+    reference.ProcessFrame(&frame[0], frame.size());
+    for (const Type descriptor : kStateful) {
+      const float* reference_data(reference.GetDescriptor(descriptor));
+      if (frame_idx % kRetrievalPeriod == 0) {
+        EXPECT_EQ(reference_data[0], manager.GetDescriptor(descriptor)[0]);
+      }
+    }
+  }
+}
+
+/// @brief Alternate noise and digital silence: below the threshold,
+/// gated descriptors have to output their silent value without computing
+/// any spectrum, and be counted as such
+TEST(Manager, SilenceGate) {
+  const float kSamplingFreq(48000.0f);
+  const float kThreshold(1e-4f);
+  const unsigned int kFramesCount(32);
+  const Type kGated[] = {
+    chartreuse::interface::DescriptorId::kAudioFundamentalFrequency,
+    chartreuse::interface::DescriptorId::kAudioHarmonicity,
+    chartreuse::interface::DescriptorId::kAudioSpectrumCentroid,
+    chartreuse::interface::DescriptorId::kHarmonicSpectralCentroid
+  };
+
+  Manager manager(Manager::Parameters(kSamplingFreq,
+                                      2048,
+                                      62.5f,
+                                      1500.0f,
+                                      chartreuse::kHopSizeSamples,
+                                      3,
+                                      0.25f,
+                                      kAutoCorrelation,
+                                      kThreshold));
+  Manager reference((Manager::Parameters(kSamplingFreq)));
+
+  std::array<float, 4> previous;
+  previous.fill(0.0f);
+  unsigned int silent_frames(0);
+  for (unsigned int frame_idx(0); frame_idx < kFramesCount; ++frame_idx) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    frame.fill(0.0f);
+    const bool kSilent((frame_idx / 4) % 2 == 1);
+    if (!kSilent) {
+      std::generate(frame.begin(),
+                    frame.end(),
+                    [&] {return kNormDistribution(kRandomGenerator);});
+    } else {
+      silent_frames += 1;
+    }
+    manager.ProcessFrame(&frame[0], frame.size());
+    reference.ProcessFrame(&frame[0], frame.size());
+    EXPECT_EQ(kSilent, manager.IsSilent());
+    EXPECT_FALSE(reference.IsSilent());
+    for (unsigned int idx(0); idx < previous.size(); ++idx) {
+      const float kValue(*manager.GetDescriptor(kGated[idx]));
+      if (!kSilent) {
+        EXPECT_EQ(*reference.GetDescriptor(kGated[idx]), kValue);
+      } else if (idx < 2) {
+        // No period, hence no harmonicity
+        EXPECT_EQ(0.0f, kValue);
+      } else {
+        // Previous value held
+        EXPECT_EQ(previous[idx], kValue);
+      }
+      previous[idx] = kValue;
+    }
+    // Nothing expensive was computed
+    EXPECT_EQ(!kSilent, manager.IsDescriptorComputed(
+      chartreuse::interface::DescriptorId::kDft));
+    EXPECT_EQ(!kSilent, manager.IsDescriptorComputed(
+      chartreuse::interface::DescriptorId::kAutoCorrelation));
+  }
+  for (const Type descriptor : kGated) {
+    EXPECT_EQ(silent_frames, manager.GateHitCount(descriptor));
+    EXPECT_EQ(0u, reference.GateHitCount(descriptor));
+  }
+  EXPECT_EQ(0u, manager.GateHitCount(
+    chartreuse::interface::DescriptorId::kAudioPower));
+
+  std::unique_ptr<Manager> clone(manager.Clone());
+  EXPECT_EQ(silent_frames, clone->GateHitCount(kGated[0]));
+  manager.Reset();
+  EXPECT_EQ(0u, manager.GateHitCount(kGated[0]));
+}
@@ -0,0 +1,95 @@
+/// @file tests_managerpool.cc
+/// @brief Chartreuse manager instances pool tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/interface/managerpool.h"
+
+// Using declarations for tested class
+using chartreuse::interface::ManagerPool;
+// Using declarations for related classes
+using chartreuse::interface::Manager;
+using chartreuse::interface::DescriptorId::kCount;
+using chartreuse::interface::DescriptorId::Type;
+
+/// @brief Acquire, use and release a manager: the next acquisition has to
+/// retrieve the same instance, behaving as a just-constructed one
+TEST(ManagerPool, Recycling) {
+  const float kSamplingFreq(48000.0f);
+  const unsigned int kPreallocated(2);
+
+  ManagerPool pool((Manager::Parameters(kSamplingFreq)), kPreallocated);
+  EXPECT_EQ(kPreallocated, pool.AvailableCount());
+
+  std::unique_ptr<Manager> manager(pool.Acquire());
+  EXPECT_EQ(kPreallocated - 1, pool.AvailableCount());
+  EXPECT_EQ(pool.SharedContext(), manager->SharedContext());
+
+  std::vector<float> used_output;
+  std::vector<float> fresh_output;
+  for (unsigned int pass(0); pass < 2; ++pass) {
+    std::vector<float>& output(pass == 0 ? used_output : fresh_output);
+    // Same signal for both passes
+    std::mt19937 generator(1);
+    std::size_t index(0);
+    while (index < kDataTestSetSize) {
+      std::array<float, chartreuse::kHopSizeSamples> frame;
+      std::generate(frame.begin(),
+                    frame.end(),
+                    [&] {return kNormDistribution(generator);});
+      manager->ProcessFrame(&frame[0], frame.size());
+      for (unsigned int descriptor_idx(0);
+           descriptor_idx < kCount;
+           ++descriptor_idx) {
+        const Type descriptor(static_cast<Type>(descriptor_idx));
+        const unsigned int kDim(manager->GetDescriptorMeta(descriptor).out_dim);
+        const float* data(manager->GetDescriptor(descriptor));
+        output.insert(output.end(), data, data + kDim);
+      }
+      index += frame.size();
+    }
+
+    const Manager* const kReleased(manager.get());
+    pool.Release(std::move(manager));
+    EXPECT_EQ(kPreallocated, pool.AvailableCount());
+    manager = pool.Acquire();
+    EXPECT_EQ(kReleased, manager.get());
+  }
+
+  ASSERT_EQ(used_output.size(), fresh_output.size());
+  for (std::size_t idx(0); idx < used_output.size(); ++idx) {
+    EXPECT_EQ(used_output[idx], fresh_output[idx]);
+  }
+}
+
+/// @brief Acquire more managers than preallocated
+TEST(ManagerPool, Growth) {
+  const float kSamplingFreq(48000.0f);
+
+  ManagerPool pool((Manager::Parameters(kSamplingFreq)));
+  EXPECT_EQ(0U, pool.AvailableCount());
+  std::unique_ptr<Manager> first(pool.Acquire());
+  std::unique_ptr<Manager> second(pool.Acquire());
+  EXPECT_NE(first.get(), second.get());
+  EXPECT_EQ(&first->Context(), &second->Context());
+  pool.Release(std::move(first));
+  pool.Release(std::move(second));
+  EXPECT_EQ(2U, pool.AvailableCount());
+}
@@ -0,0 +1,86 @@
+/// @file tests_multiresolutionmanager.cc
+/// @brief Chartreuse multi-resolution manager class tests
+/// @author gm
+/// @copyright gm 2014
+///
+/// This file is part of Chartreuse
+///
+/// Chartreuse is free software: you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation, either version 3 of the License, or
+/// (at your option) any later version.
+///
+/// Chartreuse is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License
+/// along with Chartreuse.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "chartreuse/tests/tests.h"
+
+#include "chartreuse/src/interface/multiresolutionmanager.h"
+
+// Using declarations for tested class
+using chartreuse::interface::MultiResolutionManager;
+// Using declarations for related classes
+using chartreuse::interface::Manager;
+using chartreuse::interface::DescriptorId::kCount;
+using chartreuse::interface::DescriptorId::Type;
+using chartreuse::descriptors::Descriptor_Meta;
+
+/// @brief Compute all descriptors for white noise, for two resolutions:
+/// check that they are identical to those of independent managers
+TEST(MultiResolutionManager, WhiteNoise) {
+  const float kSamplingFreq(48000.0f);
+  std::vector<Manager::Parameters> resolutions;
+  // Short window for transients
+  resolutions.push_back(Manager::Parameters(kSamplingFreq,
+                                            1024,
+                                            62.5f,
+                                            1500.0f,
+                                            chartreuse::kHopSizeSamples,
+                                            2));
+  // Default, long one
+  resolutions.push_back(Manager::Parameters(kSamplingFreq));
+
+  MultiResolutionManager multi_manager(resolutions);
+  EXPECT_EQ(resolutions.size(), multi_manager.ResolutionsCount());
+  Manager short_manager(resolutions[0]);
+  Manager long_manager(resolutions[1]);
+  Manager* const managers[] = {&short_manager, &long_manager};
+
+  std::size_t index(0);
+  while (index < kDataTestSetSize * 4) {
+    std::array<float, chartreuse::kHopSizeSamples> frame;
+    // Fill the frame with random data
+    std::generate(frame.begin(),
+                  frame.end(),
+                  [&] {return kNormDistribution(kRandomGenerator);});
+    multi_manager.ProcessFrame(&frame[0], frame.size());
+    short_manager.ProcessFrame(&frame[0], frame.size());
+    long_manager.ProcessFrame(&frame[0], frame.size());
+    for (unsigned int resolution(0);
+         resolution < multi_manager.ResolutionsCount();
+         ++resolution) {
+      for (unsigned int descriptor_idx(0);
+           descriptor_idx < kCount;
+           ++descriptor_idx) {
+        const Type descriptor(static_cast<Type>(descriptor_idx));
+        const Descriptor_Meta& desc_meta(
+          multi_manager.GetDescriptorMeta(resolution, descriptor));
+        const float* out_data(multi_manager.GetDescriptor(resolution,
+                                                          descriptor));
+        const float* expected_data(
+          managers[resolution]->GetDescriptor(descriptor));
+        for (unsigned int desc_index(0);
+             desc_index < desc_meta.out_dim;
+             ++desc_index) {
+          EXPECT_FLOAT_EQ(expected_data[desc_index], out_data[desc_index]);
+        }
+      }
+    }
+    index += frame.size();
+  }
+}
@@ -26,6 +26,7 @@
 #include <cmath>
 #include <functional>
 #include <iterator>
+#include <numeric>
 #include <random>
 #include <vector>
 
@@ -25,19 +25,102 @@ import pylab
 
 class SignalEnvelope(object):
     '''
-    Audio Spectrum centroid algorithm test implementation
+    Signal envelope and temporal descriptors algorithm test implementation
+
+    Everything is computed incrementally, frame by frame, with a constant
+    memory footprint: this is the reference for the streaming implementation
     '''
-    def __init__(self, sampling_freq, frame_length, overlap):
+    def __init__(self, sampling_freq, frame_length, overlap,
+                 attack_time = 0.005, release_time = 0.1,
+                 start_ratio = 0.02, stop_ratio = 0.9,
+                 floor = 1e-5, levels_per_decade = 20):
         self.sampling_freq = sampling_freq
         self.window_length = frame_length * overlap
+        self.frame_duration = frame_length / sampling_freq
+        self.attack_coeff = numpy.exp(-self.frame_duration / attack_time)
+        self.release_coeff = numpy.exp(-self.frame_duration / release_time)
+        self.start_ratio = start_ratio
+        self.stop_ratio = stop_ratio
+        self.levels_per_decade = levels_per_decade
+        # Levels ladder for the attack, first crossing time of each level
+        levels_count = int(numpy.ceil(numpy.log10(1.0 / floor)
+                                      * levels_per_decade)) + 1
+        self.levels = floor * 10.0 ** (numpy.arange(levels_count)
+                                       / float(levels_per_decade))
+        self.envelope = 0.0
+        self.Reset()
+
+    def Reset(self):
+        '''
+        Start a new segment
+        '''
+        self.crossing_times = numpy.zeros(len(self.levels))
+        self.crossed_count = 0
+        self.frame_idx = 0
+        self.previous = 0.0
+        self.maximum = 0.0
+        self.maximum_time = 0.0
+        self.envelope_sum = 0.0
+        self.weighted_sum = 0.0
+
+    def CrossingTime(self, ratio):
+        '''
+        First time the envelope reached the given ratio of its maximum
+        '''
+        threshold = ratio * self.maximum
+        if self.crossed_count == 0:
+            return self.maximum_time
+        if threshold <= self.levels[0]:
+            return self.crossing_times[0]
+        below = min(int(numpy.log10(threshold / self.levels[0])
+                        * self.levels_per_decade),
+                    self.crossed_count - 1)
+        if below + 1 < self.crossed_count:
+            above_level = self.levels[below + 1]
+            above_time = self.crossing_times[below + 1]
+        else:
+            above_level = self.maximum
+            above_time = self.maximum_time
+        if above_level <= self.levels[below]:
+            return self.crossing_times[below]
+        ratio = min(1.0, (threshold - self.levels[below])
+                         / (above_level - self.levels[below]))
+        return (1.0 - ratio) * self.crossing_times[below] + ratio * above_time
 
     def Process(self, frame):
         '''
-        Actual processing function, retrieve the descriptor
-        for the given frame
+        Actual processing function, retrieve the descriptors
+        for the given frame: envelope, log attack time, temporal centroid
         '''
-
-        return 0.0
+        rms = numpy.sqrt(numpy.mean(frame ** 2))
+        coeff = self.attack_coeff if rms > self.envelope else self.release_coeff
+        self.envelope = rms + coeff * (self.envelope - rms)
+
+        time = self.frame_idx * self.frame_duration
+        while (self.crossed_count < len(self.levels)
+               and self.envelope >= self.levels[self.crossed_count]):
+            ratio = ((self.levels[self.crossed_count] - self.previous)
+                     / (self.envelope - self.previous))
+            self.crossing_times[self.crossed_count] = \
+                time - (1.0 - ratio) * self.frame_duration
+            self.crossed_count += 1
+        if self.envelope > self.maximum:
+            self.maximum = self.envelope
+            self.maximum_time = time
+        self.previous = self.envelope
+        attack = (self.CrossingTime(self.stop_ratio)
+                  - self.CrossingTime(self.start_ratio))
+        log_attack_time = numpy.log10(max(attack, 1.0 / self.sampling_freq))
+
+        self.envelope_sum += self.envelope
+        self.weighted_sum += self.frame_idx * self.envelope
+        self.frame_idx += 1
+        temporal_centroid = 0.0
+        if self.envelope_sum > 0.0:
+            temporal_centroid = (self.weighted_sum / self.envelope_sum
+                                 * self.frame_duration)
+
+        return (self.envelope, log_attack_time, temporal_centroid)
 
 if __name__ == "__main__":
     from scipy import signal
@@ -56,7 +139,7 @@ if __name__ == "__main__":
     actual_num_frame = 32
     actual_in_length = actual_num_frame * frame_length
 
-    descriptor_length = 1
+    descriptor_length = 3
 
     desc_data = numpy.zeros((descriptor_length, actual_num_frame),
                             dtype = numpy.float64)